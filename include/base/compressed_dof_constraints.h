@@ -0,0 +1,198 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2025 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_COMPRESSED_DOF_CONSTRAINTS_H
+#define LIBMESH_COMPRESSED_DOF_CONSTRAINTS_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class DofConstraints;
+
+/**
+ * A read-only, compressed copy of a \p DofConstraints map.
+ *
+ * \p DofConstraints is a map of maps, which is convenient while
+ * constraints are being built and expanded but costs a tree lookup
+ * per dof whenever they are applied.  Once \p DofMap has finished
+ * processing its constraints it freezes them into this class:
+ *
+ * - Constrained dofs owned by this processor are marked in a bitmap
+ *   spanning the local dof range, so "is this dof constrained" is a
+ *   shift and a mask.
+ * - Every 64 bit word of the bitmap stores the number of constrained
+ *   dofs before it, so finding a local dof's row is O(1) as well.
+ * - The few constrained dofs owned by other processors (e.g. those
+ *   constraining ghosted dofs) are found by binary search instead,
+ *   so memory use does not grow with the global number of dofs.
+ * - Rows are stored contiguously, in CSR format, in the order of
+ *   their constrained dof ids.
+ *
+ * \brief Compressed sparse row storage of frozen DoF constraints.
+ */
+class CompressedDofConstraints
+{
+public:
+  /**
+   * Returned by \p row() for an unconstrained dof.
+   */
+  static constexpr std::size_t invalid_row = std::numeric_limits<std::size_t>::max();
+
+  CompressedDofConstraints ();
+
+  /**
+   * Replaces our contents with a copy of \p constraints, and marks
+   * us frozen.  Constrained dofs in [\p first_local_dof, \p
+   * end_local_dof) get the bitmap lookup; any others are still
+   * stored, but looked up by binary search.
+   */
+  void build (const DofConstraints & constraints,
+              const dof_id_type first_local_dof,
+              const dof_id_type end_local_dof);
+
+  /**
+   * Frees our storage, leaving us unfrozen.
+   */
+  void clear ();
+
+  /**
+   * \returns \p true if we hold an up to date copy of the
+   * constraints, \p false if callers should use the map instead.
+   */
+  bool frozen () const { return _frozen; }
+
+  /**
+   * \returns The number of constraint rows.
+   */
+  std::size_t n_rows () const { return _constrained_dofs.size(); }
+
+  /**
+   * \returns \p true if \p dof is constrained.
+   */
+  bool is_constrained (const dof_id_type dof) const;
+
+  /**
+   * \returns The row of the constraint on \p dof, or \p invalid_row
+   * if \p dof is not constrained.
+   */
+  std::size_t row (const dof_id_type dof) const;
+
+  /**
+   * \returns The first row whose constrained dof is no less than \p
+   * dof.  Rows are sorted by constrained dof, so this lets callers
+   * iterate over the rows constraining a contiguous range of dofs.
+   */
+  std::size_t lower_bound (const dof_id_type dof) const;
+
+  /**
+   * \returns The dof constrained by row \p r.
+   */
+  dof_id_type constrained_dof (const std::size_t r) const
+  { libmesh_assert_less(r, n_rows()); return _constrained_dofs[r]; }
+
+  /**
+   * \returns The number of entries in row \p r.
+   */
+  std::size_t row_size (const std::size_t r) const
+  { libmesh_assert_less(r, n_rows()); return _offsets[r+1] - _offsets[r]; }
+
+  /**
+   * \returns The dofs which row \p r constrains its dof in terms of.
+   */
+  const dof_id_type * row_dofs (const std::size_t r) const
+  { libmesh_assert_less(r, n_rows()); return _dofs.data() + _offsets[r]; }
+
+  /**
+   * \returns The coefficients of row \p r.
+   */
+  const Real * row_coefficients (const std::size_t r) const
+  { libmesh_assert_less(r, n_rows()); return _coefficients.data() + _offsets[r]; }
+
+private:
+  /**
+   * \returns The row of the constraint on \p dof, which lies outside
+   * the bitmap, or \p invalid_row if there is none.
+   */
+  std::size_t nonlocal_row (const dof_id_type dof) const;
+
+  bool _frozen;
+
+  /**
+   * The dof ids represented in the bitmap, [_first_dof, _end_dof).
+   */
+  dof_id_type _first_dof, _end_dof;
+
+  /**
+   * The number of rows constraining dofs below \p _first_dof; the
+   * rows of bitmap dofs start here.
+   */
+  std::size_t _first_local_row;
+
+  /**
+   * One bit per dof id from \p _first_dof on, set for constrained
+   * dofs.
+   */
+  std::vector<std::uint64_t> _bits;
+
+  /**
+   * The number of set bits in all words before each word.
+   */
+  std::vector<std::size_t> _rank;
+
+  /**
+   * The constrained dof of each row, in increasing order.
+   */
+  std::vector<dof_id_type> _constrained_dofs;
+
+  /**
+   * The CSR row offsets, column dofs and coefficients.
+   */
+  std::vector<std::size_t> _offsets;
+  std::vector<dof_id_type> _dofs;
+  std::vector<Real> _coefficients;
+};
+
+
+
+// ------------------------------------------------------------
+// CompressedDofConstraints inline methods
+inline
+bool CompressedDofConstraints::is_constrained (const dof_id_type dof) const
+{
+  libmesh_assert(_frozen);
+
+  if (dof < _first_dof || dof >= _end_dof)
+    return this->nonlocal_row(dof) != invalid_row;
+
+  const dof_id_type offset = dof - _first_dof;
+  return (_bits[offset / 64] >> (offset % 64)) & 1;
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_COMPRESSED_DOF_CONSTRAINTS_H
@@ -35,10 +35,12 @@
 #include "libmesh/utility.h"
 #include "libmesh/elem.h"
 #include "libmesh/fe_interface.h"
+#include "libmesh/int_range.h"
 #include "libmesh/libmesh_logging.h"
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/mesh_subdivision_support.h"
 #include "libmesh/dof_map_base.h"
+#include "libmesh/compressed_dof_constraints.h"
 
 // TIMPI includes
 #include "timpi/parallel_implementation.h"
@@ -274,6 +276,50 @@ public:
    */
   void full_sparsity_pattern_needed();
 
+  /**
+   * Enables or disables incremental sparsity pattern updates.
+   *
+   * When enabled, the sparsity pattern is kept after each
+   * compute_sparsity().  If the degrees of freedom have been
+   * distributed exactly once since, e.g. after adaptive refinement
+   * and coarsening of part of the mesh, the next compute_sparsity()
+   * only recomputes the rows touched by elements which were just
+   * refined or coarsened, or by degrees of freedom whose constraints
+   * changed; the rest of the old pattern is carried over to the new
+   * numbering.  The result is identical to a pattern built from
+   * scratch.
+   *
+   * Changed elements are found from the flags set by \p
+   * MeshRefinement, so other modifications of the mesh require a
+   * full rebuild, e.g. by disabling and re-enabling incremental
+   * updates beforehand.
+   *
+   * A full rebuild is still done whenever couplings may extend
+   * beyond single elements and their constraints, i.e. with
+   * non-default or multi-level coupling functors, implicit neighbor
+   * dofs, constrained sparsity construction, static condensation, or
+   * extra sparsity functions or objects, or when some degree of
+   * freedom in the previous pattern cannot be renumbered (e.g. one on
+   * an object this processor no longer sees).  Incremental updates
+   * require AMR support.
+   *
+   * This is disabled by default.
+   */
+  void set_incremental_sparsity (bool incremental);
+
+  /**
+   * \returns \p true iff incremental sparsity pattern updates are
+   * enabled.
+   */
+  bool incremental_sparsity () const { return _incremental_sparsity; }
+
+  /**
+   * \returns \p true iff the current sparsity pattern was updated
+   * incrementally by the last compute_sparsity(), rather than built
+   * from scratch.
+   */
+  bool sparsity_updated_incrementally () const { return _sparsity_updated_incrementally; }
+
   /**
    * Returns true iff the current policy when constructing sparsity
    * patterns is to explicitly account for sparsity entries created by
@@ -1055,16 +1101,28 @@ public:
    */
   const DofConstraints & get_dof_constraints() const { return _dof_constraints; }
 
+  /**
+   * Provide a const accessor to the compressed copy of the
+   * DofConstraints map which is built by process_constraints().  It
+   * is only valid while \p frozen(); any change to the constraints
+   * thaws it, and the map must be used instead until the next
+   * process_constraints().
+   */
+  const CompressedDofConstraints & get_compressed_dof_constraints() const
+  { return _compressed_dof_constraints; }
+
   void stash_dof_constraints()
   {
     libmesh_assert(_stashed_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _compressed_dof_constraints.clear();
   }
 
   void unstash_dof_constraints()
   {
     libmesh_assert(_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _compressed_dof_constraints.clear();
   }
 
   /**
@@ -1082,6 +1140,7 @@ public:
   void swap_dof_constraints()
   {
     _dof_constraints.swap(_stashed_dof_constraints);
+    _compressed_dof_constraints.clear();
   }
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -1572,6 +1631,10 @@ public:
    * Constrains degrees of freedom on side \p s of element \p elem which
    * correspond to variable number \p var and to p refinement levels
    * above \p p.
+   *
+   * This may be called from multiple threads at once, so it does not
+   * invalidate the compressed constraints itself; callers must do so
+   * (e.g. via \p create_dof_constraints()) before their threaded loop.
    */
   void constrain_p_dofs (unsigned int var,
                          const Elem * elem,
@@ -1687,6 +1750,22 @@ public:
 
 private:
 
+  /**
+   * Updates the sparsity pattern saved by the previous
+   * compute_sparsity() to the current mesh and degree-of-freedom
+   * numbering, recomputing only the couplings which may have changed.
+   *
+   * \returns The updated pattern, or \p nullptr on every processor if
+   * any processor needs a full rebuild instead.
+   */
+  std::unique_ptr<SparsityPattern::Build> update_sparsity(const MeshBase & mesh) const;
+
+  /**
+   * Saves the current sparsity pattern, and the constraints it was
+   * built with, for a later update_sparsity().
+   */
+  void save_sparsity_snapshot();
+
   /**
    * Helper function that gets the dof indices on the current element
    * for a non-SCALAR type variable, where the variable is identified
@@ -1870,6 +1949,15 @@ private:
 
 #ifdef LIBMESH_ENABLE_CONSTRAINTS
 
+  /**
+   * Calls \p f(dof, coefficient) for each entry in the constraint row
+   * of the constrained dof \p constrained_dof.  Uses the compressed
+   * constraints when they are frozen, and the map otherwise.
+   */
+  template <typename Func>
+  void for_each_constraint_entry (const dof_id_type constrained_dof,
+                                  Func && f) const;
+
   /**
    * Build the constraint matrix C associated with the element
    * degree of freedom indices elem_dofs. The optional parameter
@@ -2088,6 +2176,26 @@ private:
    */
   std::unique_ptr<SparsityPattern::Build> _sp;
 
+  /**
+   * Set to true to update sparsity patterns incrementally.
+   */
+  bool _incremental_sparsity;
+
+  /**
+   * True iff the last compute_sparsity() updated the previous
+   * pattern.
+   */
+  bool _sparsity_updated_incrementally;
+
+  /**
+   * The sparsity pattern rows and constraints kept for incremental
+   * updates, and the degrees of freedom changed since.  Defined in
+   * dof_map.C.
+   */
+  struct SparsitySnapshot;
+
+  std::unique_ptr<SparsitySnapshot> _sparsity_snapshot;
+
   /**
    * The total number of SCALAR dofs associated to
    * all SCALAR variables.
@@ -2115,6 +2223,12 @@ private:
    */
   DofConstraints _dof_constraints, _stashed_dof_constraints;
 
+  /**
+   * A frozen, compressed copy of \p _dof_constraints for fast
+   * lookups while applying constraints.
+   */
+  CompressedDofConstraints _compressed_dof_constraints;
+
   DofConstraintValueMap      _primal_constraint_values;
 
   AdjointDofConstraintValues _adjoint_constraint_values;
@@ -2267,6 +2381,9 @@ bool DofMap::is_constrained_node (const Node *
 inline
 bool DofMap::is_constrained_dof (const dof_id_type dof) const
 {
+  if (_compressed_dof_constraints.frozen())
+    return _compressed_dof_constraints.is_constrained(dof);
+
   if (_dof_constraints.count(dof))
     return true;
 
@@ -2274,6 +2391,33 @@ bool DofMap::is_constrained_dof (const dof_id_type dof) const
 }
 
 
+template <typename Func>
+inline
+void DofMap::for_each_constraint_entry (const dof_id_type constrained_dof,
+                                        Func && f) const
+{
+  if (_compressed_dof_constraints.frozen())
+    {
+      const std::size_t r = _compressed_dof_constraints.row(constrained_dof);
+      libmesh_assert_not_equal_to (r, CompressedDofConstraints::invalid_row);
+
+      const dof_id_type * dofs = _compressed_dof_constraints.row_dofs(r);
+      const Real * coefs = _compressed_dof_constraints.row_coefficients(r);
+      for (auto k : make_range(_compressed_dof_constraints.row_size(r)))
+        f(dofs[k], coefs[k]);
+    }
+  else
+    {
+      const DofConstraints::const_iterator pos =
+        _dof_constraints.find(constrained_dof);
+      libmesh_assert (pos != _dof_constraints.end());
+
+      for (const auto & [dof, coef] : pos->second)
+        f(dof, coef);
+    }
+}
+
+
 inline
 bool DofMap::has_heterogeneous_adjoint_constraints (const unsigned int qoi_num) const
 {
@@ -27,6 +27,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/small_vector.h"
 
 // C++ includes
 #include <cstddef>
@@ -674,9 +675,14 @@ private:
    * [-5 11 11 13 17 () (ncv_0 idx_0 ncv_1 idx_1 ncv_2 idx_2) () (ncv_0 idx_0) (ncv_0 idx_0 ncv_1 idx_1) (xtra1 xtra2)]
    * [0   1  2  3  4         5     6     7     8     9    10         11    12      13    14    15    16      17    18]
    * \endverbatim
+   *
+   * The buffer of a \p DofObject with a single system and variable
+   * group and no extra integers, [1 ncv_0 idx_0], is by far the most
+   * common case, so buffers of up to that size are stored inline
+   * rather than in a separate heap allocation.
    */
   typedef dof_id_type index_t;
-  typedef std::vector<index_t> index_buffer_t;
+  typedef SmallVector<index_t, 3> index_buffer_t;
   index_buffer_t _idx_buf;
 
   /**
@@ -715,7 +721,7 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<dof_id_type> & buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
 #endif
 };
 
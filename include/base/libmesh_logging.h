@@ -25,6 +25,7 @@
 #include "libmesh/libmesh_common.h"
 
 #include "libmesh/perf_log.h"
+#include "libmesh/trace_log.h"
 
 // Two-level macro substitution trick, used to construct a unique
 // variable name for a given line.
@@ -58,6 +59,9 @@ extern PerfLog perflog;
  * LOG_SCOPE macro, which resolves to nothing at compile time if
  * logging is disabled.
  *
+ * The item is also recorded by \p tracelog, if tracing is enabled,
+ * even in threads where the \p PerfLog itself is disabled.
+ *
  * \author John Peterson
  * \date 2016
  */
@@ -70,14 +74,19 @@ struct PerfItem
     _label(label),
     _header(header),
     _enabled(enabled),
+    _traced(enabled && tracelog.enabled()),
     _perflog(*my_perflog)
   {
     if (_enabled)
       _perflog.fast_push(label, header);
+    if (_traced)
+      tracelog.begin(label, header);
   }
 
   ~PerfItem()
   {
+    if (_traced)
+      tracelog.end();
     if (_enabled)
       _perflog.fast_pop(_label, _header);
   }
@@ -86,6 +95,7 @@ private:
   const char * _label;
   const char * _header;
   bool _enabled;
+  bool _traced;
   PerfLog & _perflog;
 };
 
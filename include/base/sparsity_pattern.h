@@ -68,6 +68,67 @@ static void sort_row (const BidirectionalIterator begin,
                       BidirectionalIterator       middle,
                       const BidirectionalIterator end);
 
+/**
+ * Maps indices in one numbering of degrees of freedom to those in
+ * another.  Indices in one contiguous range, usually those local to
+ * this processor, are kept in a flat array; the few others which
+ * may be needed are listed up front, sorted, and looked up by
+ * bisection.  Indices without an image, or which were not listed,
+ * map to \p invalid.
+ */
+class IndexMap
+{
+public:
+  static constexpr dof_id_type invalid = static_cast<dof_id_type>(-1);
+
+  IndexMap (const dof_id_type first,
+            const dof_id_type end,
+            std::vector<dof_id_type> others);
+
+  /**
+   * Sets the image of \p from to \p to.  Does nothing if \p from
+   * is neither in range nor listed.
+   */
+  void insert (const dof_id_type from, const dof_id_type to)
+  {
+    const std::size_t i = this->slot(from);
+    if (i != _images.size())
+      _images[i] = to;
+  }
+
+  /**
+   * \returns The image of \p from, or \p invalid.
+   */
+  dof_id_type operator() (const dof_id_type from) const
+  {
+    const std::size_t i = this->slot(from);
+    return (i == _images.size()) ? invalid : _images[i];
+  }
+
+private:
+  /**
+   * \returns The position of the image of \p from in \p _images,
+   * or its size if \p from has no place there.
+   */
+  std::size_t slot (const dof_id_type from) const
+  {
+    if (from >= _first && from - _first < _n_range)
+      return from - _first;
+
+    const auto it = std::lower_bound(_others.begin(), _others.end(), from);
+    if (it == _others.end() || *it != from)
+      return _images.size();
+    return _n_range + std::distance(_others.begin(), it);
+  }
+
+  const dof_id_type _first;
+  const dof_id_type _n_range;
+  const std::vector<dof_id_type> _others;
+
+  // Images of the range, followed by images of the others
+  std::vector<dof_id_type> _images;
+};
+
 
 
   /**
@@ -99,6 +160,13 @@ static void sort_row (const BidirectionalIterator begin,
  * preallocation.  In this case it suffices to provide estimate
  * (but bounding) values, and in this case the threaded method can
  * take some short-cuts for efficiency.
+ *
+ * When only the counts are needed, \p count_nonzeros() can be used
+ * instead of a threaded loop and \p parallel_sync().  It makes two
+ * passes over the elements, and frees each row as soon as it is
+ * complete, so that peak memory use is proportional to the rows on
+ * the "frontier" of the element loop rather than to the whole
+ * pattern.
  */
 class Build : public ParallelObject
 {
@@ -145,6 +213,39 @@ public:
    */
   void parallel_sync ();
 
+  /**
+   * Adds the rows \p old_rows, which start at global index \p
+   * old_first_dof and were built for a previous numbering of the same
+   * degrees of freedom, to this object's sparsity pattern.  Indices
+   * are translated by \p old_to_new.  Rows which no longer exist, or
+   * whose new index is in the sorted list \p skip_rows, are not
+   * added.  Rows which now belong to other processors are sent to
+   * them by the next \p parallel_sync().
+   *
+   * \returns \p false if some index in an added row had no new
+   * index, in which case the row is incomplete.
+   */
+  bool add_renumbered_rows (const SparsityPattern::Graph & old_rows,
+                            const dof_id_type old_first_dof,
+                            const SparsityPattern::IndexMap & old_to_new,
+                            const std::vector<dof_id_type> & skip_rows);
+
+  /**
+   * Computes \p n_nz and \p n_oz for the elements in \p range, in
+   * place of running this object over \p range and then calling \p
+   * parallel_sync().  Only valid if the full sparsity pattern is not
+   * needed.
+   *
+   * A first pass counts how many element couplings touch each local
+   * row, and tells other processors which of their rows we will
+   * send them.  The second pass builds rows as usual, but counts and
+   * frees each row once its last coupling has been added, unless
+   * another processor will be contributing to it.  This does not use
+   * threads, since rows can only be finished once every coupling has
+   * been seen.
+   */
+  void count_nonzeros (const ConstElemRange & range);
+
   /**
    * Rows of sparse matrix indices, indexed by the offset from the
    * first DoF on this processor.
@@ -230,9 +331,28 @@ private:
   /// A dummy work vector to avoid repeated memory allocations
   std::vector<dof_id_type> dummy_vec;
 
+  /// Work vectors to avoid repeated memory allocations
+  std::vector<std::vector<dof_id_type>> element_dofs;
+  std::vector<dof_id_type> partner_dofs, dofs_to_add;
+  SparsityPattern::Row merged_row;
+
   void handle_vi_vj(const std::vector<dof_id_type> & element_dofs_i,
                     const std::vector<dof_id_type> & element_dofs_j);
 
+  /**
+   * Calls \p f(element_dofs_i, element_dofs_j) for every pair of
+   * coupled dof sets on the elements in \p range.
+   */
+  template <typename PairFunctor>
+  void for_each_coupling(const ConstElemRange & range,
+                         PairFunctor f);
+
+  /**
+   * Merges the sorted, unique row \p their_row into \p my_row.
+   */
+  void merge_row(SparsityPattern::Row & my_row,
+                 const SparsityPattern::Row & their_row);
+
   void sorted_connected_dofs(const Elem * elem,
                              std::vector<dof_id_type> & dofs_vi,
                              unsigned int vi);
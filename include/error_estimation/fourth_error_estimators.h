@@ -67,6 +67,11 @@ public:
 
 protected:
 
+  /**
+   * \returns A copy of this estimator for another thread to use.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone () const override;
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
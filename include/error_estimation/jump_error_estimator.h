@@ -22,8 +22,12 @@
 
 // Local Includes
 #include "libmesh/dense_vector.h"
+#include "libmesh/elem_range.h"
 #include "libmesh/error_estimator.h"
+#include "libmesh/error_vector.h"
 #include "libmesh/fem_context.h"
+#include "libmesh/point_locator_base.h"
+#include "libmesh/threads.h"
 
 // C++ includes
 #include <cstddef>
@@ -83,6 +87,10 @@ public:
    * estimate formula to estimate the error on each cell.
    * The estimated error is output in the vector
    * \p error_per_cell
+   *
+   * Elements are processed on all available threads if the derived
+   * class implements \p clone(), and on one thread otherwise.  Each
+   * side between two elements is still only integrated once.
    */
   virtual void estimate_error (const System & system,
                                ErrorVector & error_per_cell,
@@ -130,6 +138,24 @@ public:
   bool integrate_slits;
 
 protected:
+  /**
+   * \returns A new estimator of the same type and with the same
+   * settings as this one, to be used by another thread, or \p nullptr
+   * if this estimator can't be copied.  The default returns
+   * \p nullptr, so that estimators which don't override this, or
+   * which are subclasses of one that does, are only ever run on one
+   * thread.  Overriding this also promises that \p init_context()
+   * and the side integrations only modify the estimator they are
+   * called on, and that any user functions they call are thread safe.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone () const;
+
+  /**
+   * Copies the settings of \p other, but not its working data, for
+   * use in \p clone().
+   */
+  void copy_settings_from (const JumpErrorEstimator & other);
+
   /**
    * A utility function to reinit the finite element data on elements sharing a
    * side
@@ -183,6 +209,62 @@ protected:
    * The variable number currently being evaluated
    */
   unsigned int var;
+
+private:
+
+  /**
+   * Builds \p fine_context and \p coarse_context for \p system, and
+   * lets the derived class initialize them.
+   */
+  void build_contexts (const System & system);
+
+  /**
+   * Adds the jump error contributions of the sides of \p e, and of
+   * its parent if it is the parent's first local child and
+   * \p estimate_parent_error is set, to \p error_per_cell and
+   * \p n_flux_faces.
+   */
+  void integrate_elem_sides (const System & system,
+                             const Elem * e,
+                             bool estimate_parent_error,
+                             PointLocatorBase * point_locator,
+                             ErrorVector & error_per_cell,
+                             std::vector<float> & n_flux_faces);
+
+  /**
+   * Class to compute the error contributions for a range of
+   * elements.  Each thread's body integrates with its own clone of
+   * the estimator and sums into its own error vectors, which are
+   * added together when the bodies are joined.
+   */
+  class EstimateError
+  {
+  public:
+    EstimateError (const System & sys,
+                   JumpErrorEstimator & ee,
+                   bool estimate_parent,
+                   ErrorVector & epc,
+                   std::vector<float> & nff);
+
+    EstimateError (EstimateError & other, Threads::split);
+
+    void operator() (const ConstElemRange & range);
+
+    void join (const EstimateError & other);
+
+  private:
+    const System & system;
+    std::unique_ptr<JumpErrorEstimator> estimator_copy;
+    JumpErrorEstimator & error_estimator;
+    const bool estimate_parent_error;
+    std::unique_ptr<PointLocatorBase> point_locator;
+    ErrorVector local_error_per_cell;
+    std::vector<float> local_n_flux_faces;
+    ErrorVector & error_per_cell;
+    std::vector<float> & n_flux_faces;
+  };
+
+  friend class EstimateError;
 };
 
 
@@ -83,6 +83,7 @@ public:
 
   /**
    * Register a user function to use in computing the flux BCs.
+   * The function may be called from several threads at once.
    */
   void attach_flux_bc_function (std::pair<bool,Real> fptr(const System & system,
                                                           const Point & p,
@@ -92,6 +93,12 @@ public:
 
 protected:
 
+  /**
+   * \returns A copy of this estimator, including its BC function,
+   * for another thread to use.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone () const override;
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects.
@@ -1788,4 +1788,64 @@ void FE<MyDim,MyType>::all_shape_derivs              \
 }
 
 
+// Like LIBMESH_DEFAULT_VECTORIZED_FE, but all_shapes() and
+// all_shape_derivs() first try TensorFunc, a sum-factorized
+// evaluation which returns false for any element or point set it
+// doesn't handle.  TensorFunc(elem,o,p,v,comps,add_p_level) fills
+// *v if v is non-null, or the derivatives in comps otherwise.
+#define LIBMESH_TENSOR_VECTORIZED_FE(MyDim, MyType, TensorFunc) \
+template<>                                           \
+void FE<MyDim,MyType>::all_shapes                    \
+  (const Elem * elem,                                \
+   const Order o,                                    \
+   const std::vector<Point> & p,                     \
+   std::vector<std::vector<OutputShape>> & v,        \
+   const bool add_p_level)                           \
+{                                                    \
+  if (!TensorFunc(elem,o,p,&v,nullptr,add_p_level))  \
+    FE<MyDim,MyType>::default_all_shapes             \
+      (elem,o,p,v,add_p_level);                      \
+}                                                    \
+                                                     \
+template<>                                           \
+void FE<MyDim,MyType>::shapes                        \
+  (const Elem * elem,                                \
+   const Order o,                                    \
+   const unsigned int i,                             \
+   const std::vector<Point> & p,                     \
+   std::vector<OutputShape> & v,                     \
+   const bool add_p_level)                           \
+{                                                    \
+  FE<MyDim,MyType>::default_shapes                   \
+    (elem,o,i,p,v,add_p_level);                      \
+}                                                    \
+                                                     \
+template<>                                           \
+void FE<MyDim,MyType>::shape_derivs                  \
+  (const Elem * elem,                                \
+   const Order o,                                    \
+   const unsigned int i,                             \
+   const unsigned int j,                             \
+   const std::vector<Point> & p,                     \
+   std::vector<OutputShape> & v,                     \
+   const bool add_p_level)                           \
+{                                                    \
+  FE<MyDim,MyType>::default_shape_derivs             \
+    (elem,o,i,j,p,v,add_p_level);                    \
+}                                                    \
+                                                     \
+template<>                                           \
+void FE<MyDim,MyType>::all_shape_derivs              \
+  (const Elem * elem,                                \
+   const Order o,                                    \
+   const std::vector<Point> & p,                     \
+   std::vector<std::vector<OutputShape>> * comps[3], \
+   const bool add_p_level)                           \
+{                                                    \
+  if (!TensorFunc(elem,o,p,nullptr,comps,add_p_level)) \
+    FE<MyDim,MyType>::default_all_shape_derivs       \
+      (elem,o,p,comps,add_p_level);                  \
+}
+
+
 #endif // LIBMESH_FE_H
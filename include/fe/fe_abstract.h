@@ -603,6 +603,12 @@ public:
    */
   friend std::ostream & operator << (std::ostream & os, const FEAbstract & fe);
 
+  /**
+   * \p FEElementBlock needs our quadrature rule, and to know whether
+   * our shape functions vary from element to element.
+   */
+  friend class FEElementBlock;
+
   /**
    * request phi calculations
    */
@@ -25,6 +25,7 @@
 #include "libmesh/compare_types.h"
 #include "libmesh/fe_abstract.h"
 #include "libmesh/fe_transformation_base.h"
+#include "libmesh/flat_shape_array.h"
 #include "libmesh/point.h"
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/tensor_tools.h"
@@ -238,6 +239,34 @@ public:
   virtual void request_dphi() const override
   { get_dphi(); }
 
+  /**
+   * \returns The shape function values at the quadrature points, in
+   * contiguous storage with one cache-aligned row per shape function.
+   * Indexing is the same as for \p get_phi(), but each row can be
+   * streamed over quadrature points without chasing pointers, which
+   * lets the compiler vectorize assembly loops.
+   *
+   * The flat array is a copy of \p get_phi(), made by every reinit()
+   * once this method has been called, and never if it is not, so
+   * the reference may be kept like that from \p get_phi().  As with
+   * \p get_phi(), it must first be called before the first reinit()
+   * so that \p phi is calculated.
+   */
+  const FlatShapeArray<OutputShape> & get_flat_phi() const
+  { get_phi();
+    if (calculations_started && !calculate_flat_phi)
+      flat_phi.assign(phi);
+    calculate_flat_phi = true; return flat_phi; }
+
+  /**
+   * \returns A contiguous copy of \p get_dphi(); see \p get_flat_phi().
+   */
+  const FlatShapeArray<OutputGradient> & get_flat_dphi() const
+  { get_dphi();
+    if (calculations_started && !calculate_flat_dphi)
+      flat_dphi.assign(dphi);
+    calculate_flat_dphi = true; return flat_dphi; }
+
   virtual void request_dual_dphi() const override
   { get_dual_dphi(); }
 
@@ -324,6 +353,15 @@ public:
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dual = calculate_dphiref = true; return dual_d2phi; }
 
+  /**
+   * \returns A contiguous copy of \p get_d2phi(); see \p get_flat_phi().
+   */
+  const FlatShapeArray<OutputTensor> & get_flat_d2phi() const
+  { get_d2phi();
+    if (calculations_started && !calculate_flat_d2phi)
+      flat_d2phi.assign(d2phi);
+    calculate_flat_d2phi = true; return flat_d2phi; }
+
   /**
    * \returns The shape function second derivatives at the quadrature
    * points.
@@ -602,6 +640,14 @@ protected:
    */
   void compute_dual_shape_functions();
 
+  /**
+   * Copies \p phi, \p dphi and \p d2phi into whichever of their
+   * flat counterparts have been requested.  Every
+   * \p compute_shape_functions() implementation should call this
+   * when it is done.
+   */
+  void update_flat_shapes();
+
   /**
    * Object that handles computing shape function values, gradients, etc
    * in the physical domain.
@@ -736,6 +782,22 @@ protected:
 
 #endif
 
+  /**
+   * Have the flat copies of \p phi, \p dphi and \p d2phi been
+   * requested?
+   */
+  mutable bool calculate_flat_phi, calculate_flat_dphi, calculate_flat_d2phi;
+
+  /**
+   * Contiguous copies of \p phi, \p dphi and \p d2phi, updated by
+   * each reinit() once requested.
+   */
+  mutable FlatShapeArray<OutputShape> flat_phi;
+  mutable FlatShapeArray<OutputGradient> flat_dphi;
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+  mutable FlatShapeArray<OutputTensor> flat_d2phi;
+#endif
+
 
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
 
@@ -856,6 +918,9 @@ FEGenericBase<OutputType>::FEGenericBase(const unsigned int d,
   d2phidydz(),
   d2phidz2()
 #endif
+  ,calculate_flat_phi(false),
+  calculate_flat_dphi(false),
+  calculate_flat_d2phi(false)
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
   ,dphase(),
   dweight(),
@@ -0,0 +1,175 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2025 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_ELEMENT_BLOCK_H
+#define LIBMESH_FE_ELEMENT_BLOCK_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fe_base.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+
+/**
+ * Evaluates the shape functions, their physical gradients and the
+ * quadrature weights of a scalar-valued finite element on a whole
+ * block of elements at once, for assembly kernels which loop over
+ * several elements together.
+ *
+ * All the elements in a block must have the same type and p-level.
+ * Every element is then evaluated with the reference shape function
+ * data computed once, by one ordinary reinit() of the wrapped \p FE
+ * object.  For an element with an affine map, the Jacobian is
+ * constant, so each element costs one small metric inversion, and
+ * the gradients of all the elements are then filled in one loop
+ * which vectorizes across elements.  Any element this fast path does
+ * not cover falls back on a regular reinit() of the wrapped object.
+ * Such elements include non-affine elements, non-Lagrange mappings
+ * and families whose shape functions depend on the element.
+ *
+ * The results are stored structure-of-arrays style, with the element
+ * index varying fastest: the value for element \p e, shape function
+ * \p i and quadrature point \p qp of e.g. \p get_dphidx() is at
+ * \p index(e,i,qp) = (i*n_qp() + qp)*n_elem() + e, and \p get_JxW()
+ * is indexed by \p qp*n_elem() + e.
+ *
+ * \brief Batched FE reinit over blocks of same-type elements.
+ */
+class FEElementBlock
+{
+public:
+  /**
+   * Constructor.  \p fe must have a quadrature rule attached, and
+   * must not have been reinit()ed yet, because we request the values
+   * we need from it here.
+   */
+  explicit FEElementBlock (FEBase & fe);
+
+  /**
+   * Computes the shape function values, physical gradients and JxW
+   * on every element in \p elems.
+   */
+  void reinit (const std::vector<const Elem *> & elems);
+
+  /**
+   * \returns The number of elements in the current block.
+   */
+  unsigned int n_elem () const { return _n_elem; }
+
+  /**
+   * \returns The number of quadrature points per element.
+   */
+  unsigned int n_qp () const { return _n_qp; }
+
+  /**
+   * \returns The number of shape functions per element.
+   */
+  unsigned int n_shape_functions () const { return _n_shapes; }
+
+  /**
+   * \returns The index of element \p e, shape function \p i,
+   * quadrature point \p qp in the shape function arrays.
+   */
+  std::size_t index (unsigned int e, unsigned int i, unsigned int qp) const
+  { return (std::size_t(i)*_n_qp + qp)*_n_elem + e; }
+
+  /**
+   * \returns The quadrature weights times the Jacobian determinant,
+   * indexed by \p qp*n_elem() + e.
+   */
+  const std::vector<Real> & get_JxW () const { return _JxW; }
+
+  /**
+   * \returns The shape function values, indexed by \p index().
+   */
+  const std::vector<Real> & get_phi () const { return _phi; }
+
+  /**
+   * \returns The shape function x, y and z derivatives, indexed by
+   * \p index().
+   */
+  const std::vector<Real> & get_dphidx () const { return _dphidx; }
+  const std::vector<Real> & get_dphidy () const { return _dphidy; }
+  const std::vector<Real> & get_dphidz () const { return _dphidz; }
+
+  /**
+   * Convenience accessors for a single entry.
+   */
+  Real JxW (unsigned int e, unsigned int qp) const
+  { return _JxW[std::size_t(qp)*_n_elem + e]; }
+
+  Real phi (unsigned int e, unsigned int i, unsigned int qp) const
+  { return _phi[this->index(e,i,qp)]; }
+
+  RealGradient dphi (unsigned int e, unsigned int i, unsigned int qp) const;
+
+private:
+  /**
+   * Computes the inverse metric factors of \p elem into column \p e
+   * of \p _dxidx, assuming an affine map.  \returns The constant
+   * Jacobian determinant.
+   */
+  Real compute_affine_metric (const Elem & elem, unsigned int e);
+
+  /**
+   * Copies the results of a full reinit() of \p _fe on \p elem into
+   * column \p e of our arrays.
+   */
+  void reinit_one (const Elem & elem, unsigned int e);
+
+  FEBase & _fe;
+
+  unsigned int _n_elem, _n_qp, _n_shapes;
+
+  std::vector<Real> _JxW, _phi, _dphidx, _dphidy, _dphidz;
+
+  /**
+   * Inverse map derivatives d(xi_k)/d(x_j) for each element, indexed
+   * by (3*k + j)*n_elem() + e.
+   */
+  std::vector<Real> _dxidx;
+
+  /**
+   * Elements which need a full reinit().
+   */
+  std::vector<unsigned int> _slow_elems;
+};
+
+
+
+inline
+RealGradient FEElementBlock::dphi (unsigned int e,
+                                   unsigned int i,
+                                   unsigned int qp) const
+{
+  const std::size_t ix = this->index(e,i,qp);
+  return RealGradient(_dphidx[ix], _dphidy[ix], _dphidz[ix]);
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_ELEMENT_BLOCK_H
@@ -0,0 +1,232 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2025 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FLAT_SHAPE_ARRAY_H
+#define LIBMESH_FLAT_SHAPE_ARRAY_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstddef>
+#include <new> // std::align_val_t
+#include <numeric> // std::gcd
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A minimal allocator returning storage aligned to \p Alignment bytes.
+ */
+template <typename T, std::size_t Alignment>
+struct AlignedAllocator
+{
+  typedef T value_type;
+
+  template <typename U>
+  struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+
+  AlignedAllocator () = default;
+
+  template <typename U>
+  AlignedAllocator (const AlignedAllocator<U, Alignment> &) {}
+
+  T * allocate (std::size_t n)
+  {
+    return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+  }
+
+  void deallocate (T * p, std::size_t)
+  {
+    ::operator delete(p, std::align_val_t(Alignment));
+  }
+
+  template <typename U>
+  bool operator== (const AlignedAllocator<U, Alignment> &) const { return true; }
+
+  template <typename U>
+  bool operator!= (const AlignedAllocator<U, Alignment> &) const { return false; }
+};
+
+
+
+/**
+ * Contiguous storage for shape function (or mapping) data, indexed
+ * the same way as the \p std::vector<std::vector<T>> returned by
+ * e.g. \p FEGenericBase::get_phi(): the first index is the shape
+ * function, the second the quadrature point.
+ *
+ * All the values for one shape function are stored contiguously,
+ * and each of those rows starts on a cache line boundary, so loops
+ * over quadrature points inside a loop over shape functions can be
+ * vectorized by the compiler.  A row is padded at the end where
+ * necessary; \p stride() gives the distance between the starts of
+ * consecutive rows, and the padding entries have unspecified values.
+ *
+ * \p operator[] returns a lightweight view of one row, which
+ * supports \p operator[], \p size(), \p data() and range-based for,
+ * so code written against the nested vector interface (e.g.
+ * templated assembly kernels) works unmodified with this container.
+ *
+ * \brief Contiguous, aligned [n_shapes x n_qp] storage.
+ */
+template <typename T>
+class FlatShapeArray
+{
+public:
+  /**
+   * The alignment, in bytes, of each row.
+   */
+  static constexpr std::size_t alignment = 64;
+
+  /**
+   * A view of the values of one shape function at every quadrature
+   * point.
+   */
+  template <typename U>
+  class RowView
+  {
+  public:
+    RowView (U * data, std::size_t size) : _data(data), _size(size) {}
+
+    U & operator[] (std::size_t qp) const
+    { libmesh_assert_less (qp, _size); return _data[qp]; }
+
+    std::size_t size () const { return _size; }
+
+    bool empty () const { return _size == 0; }
+
+    U * data () const { return _data; }
+
+    U * begin () const { return _data; }
+
+    U * end () const { return _data + _size; }
+
+  private:
+    U * _data;
+    std::size_t _size;
+  };
+
+  typedef RowView<T> row_type;
+  typedef RowView<const T> const_row_type;
+
+  FlatShapeArray () : _n_rows(0), _n_cols(0), _stride(0) {}
+
+  /**
+   * Resizes to \p n_rows shape functions and \p n_cols quadrature
+   * points.  Storage is only reallocated if it grows, so repeatedly
+   * resizing to the same dimensions (as happens on every reinit())
+   * costs nothing.  Values are left unspecified.
+   */
+  void resize (std::size_t n_rows, std::size_t n_cols)
+  {
+    // Round each row up to a whole number of alignment boundaries
+    const std::size_t pad = alignment / std::gcd(alignment, sizeof(T));
+    _stride = (n_cols + pad - 1) / pad * pad;
+    _n_rows = n_rows;
+    _n_cols = n_cols;
+
+    if (_values.size() < _n_rows * _stride)
+      _values.resize(_n_rows * _stride);
+  }
+
+  /**
+   * Resizes to match \p nested and copies its values in.  All rows
+   * of \p nested must have the same length.
+   */
+  void assign (const std::vector<std::vector<T>> & nested)
+  {
+    this->resize(nested.size(), nested.empty() ? 0 : nested[0].size());
+
+    for (std::size_t i = 0; i != _n_rows; ++i)
+      {
+        libmesh_assert_equal_to (nested[i].size(), _n_cols);
+        T * row = this->row_data(i);
+        const T * src = nested[i].data();
+        for (std::size_t qp = 0; qp != _n_cols; ++qp)
+          row[qp] = src[qp];
+      }
+  }
+
+  /**
+   * Frees all storage.
+   */
+  void clear ()
+  {
+    _values.clear();
+    _values.shrink_to_fit();
+    _n_rows = _n_cols = _stride = 0;
+  }
+
+  /**
+   * \returns The number of shape functions (rows).
+   */
+  std::size_t size () const { return _n_rows; }
+
+  bool empty () const { return _n_rows == 0; }
+
+  /**
+   * \returns The number of quadrature points (the length of each row).
+   */
+  std::size_t n_qp () const { return _n_cols; }
+
+  /**
+   * \returns The distance, in elements, between consecutive rows.
+   */
+  std::size_t stride () const { return _stride; }
+
+  T & operator() (std::size_t i, std::size_t qp)
+  {
+    libmesh_assert_less (i, _n_rows);
+    libmesh_assert_less (qp, _n_cols);
+    return _values[i*_stride + qp];
+  }
+
+  const T & operator() (std::size_t i, std::size_t qp) const
+  {
+    libmesh_assert_less (i, _n_rows);
+    libmesh_assert_less (qp, _n_cols);
+    return _values[i*_stride + qp];
+  }
+
+  row_type operator[] (std::size_t i)
+  { return row_type(this->row_data(i), _n_cols); }
+
+  const_row_type operator[] (std::size_t i) const
+  { return const_row_type(this->row_data(i), _n_cols); }
+
+  /**
+   * \returns A pointer to the (aligned) start of row \p i.
+   */
+  T * row_data (std::size_t i)
+  { libmesh_assert_less (i, _n_rows); return _values.data() + i*_stride; }
+
+  const T * row_data (std::size_t i) const
+  { libmesh_assert_less (i, _n_rows); return _values.data() + i*_stride; }
+
+private:
+  std::size_t _n_rows, _n_cols, _stride;
+
+  std::vector<T, AlignedAllocator<T, alignment>> _values;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FLAT_SHAPE_ARRAY_H
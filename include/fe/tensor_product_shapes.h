@@ -0,0 +1,205 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2025 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_TENSOR_PRODUCT_SHAPES_H
+#define LIBMESH_TENSOR_PRODUCT_SHAPES_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <array>
+#include <functional>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Sum-factorized evaluation of tensor-product shape functions on
+ * tensor-product point sets, for Quad and Hex elements.
+ *
+ * When the reference points form a Cartesian grid, as the points of
+ * a tensor-product rule such as \p QGauss do, a shape function
+ * phi(xi,eta,zeta) = f_a(xi) f_b(eta) f_c(zeta) only needs the 1D
+ * functions at the distinct 1D coordinates.  We tabulate those once,
+ * in O(p) evaluations per direction, after which every value or
+ * derivative at a point is a product of table entries instead of a
+ * full pointwise evaluation.
+ *
+ * The same tables give matrix-free operator action.  Interpolating a
+ * field from its coefficients to the points, and integrating a field
+ * at the points against every shape function, are then done one
+ * direction at a time.  On a Hex with (p+1)^3 shape functions and
+ * points this costs O(p^4) rather than the O(p^6) of multiplying by
+ * the full shape function table.
+ *
+ * \brief Sum-factorized tensor-product shape function evaluation.
+ */
+class TensorProductShapes
+{
+public:
+  /**
+   * A 1D shape function (or derivative) f_i(xi).
+   */
+  typedef std::function<Real(unsigned int, Real)> Function1D;
+
+  /**
+   * How one shape function factors into 1D functions.  Factor \p k is
+   * 1D function \p index[k] evaluated at reference coordinate
+   * \p coord[k], negated first if \p flip[k] is set; the product is
+   * then multiplied by \p scale.  The permutation and flips let
+   * families with orientation-dependent edge and face functions, such
+   * as HIERARCHIC, use the same tables.
+   */
+  struct Factorization
+  {
+    std::array<unsigned int, 3> index {{0, 0, 0}};
+    std::array<unsigned int, 3> coord {{0, 1, 2}};
+    std::array<bool, 3> flip {{false, false, false}};
+    Real scale = 1;
+  };
+
+  TensorProductShapes ();
+
+  /**
+   * Finds the tensor-product structure of the \p dim dimensional
+   * reference points \p p.  \returns \p false, leaving this object
+   * unusable, if \p p is not a complete Cartesian grid.
+   */
+  bool init (unsigned int dim,
+             const std::vector<Point> & p);
+
+  /**
+   * Evaluates the \p n_1d 1D functions \p shape and their derivatives
+   * \p deriv at every distinct 1D coordinate (and its negative).  Must
+   * be called after a successful \p init().
+   */
+  void tabulate (unsigned int n_1d,
+                 const Function1D & shape,
+                 const Function1D & deriv);
+
+  /**
+   * Fills \p v[qp] with the shape function described by \p f at every
+   * point.
+   */
+  void values (const Factorization & f,
+               std::vector<Real> & v) const;
+
+  /**
+   * Fills \p (*d[j])[qp] with the derivative with respect to
+   * reference coordinate \p j of the shape function described by \p
+   * f, for every \p j < dim.
+   */
+  void derivs (const Factorization & f,
+               std::vector<Real> * const d[3]) const;
+
+  /**
+   * \returns The index of the tensor-product shape function with 1D
+   * indices \p index in the lexicographic ordering (first index
+   * fastest) used for coefficients by the operator action methods.
+   */
+  unsigned int lexicographic_index (const std::array<unsigned int, 3> & index) const;
+
+  /**
+   * Sum-factorized interpolation: sets \p u_qp[qp] to
+   * sum_i u[i] phi_i(p[qp]), for coefficients \p u in lexicographic
+   * order.
+   */
+  void interpolate (const std::vector<Number> & u,
+                    std::vector<Number> & u_qp) const;
+
+  /**
+   * Sum-factorized reference gradient: sets \p (*du_qp[j])[qp] to
+   * sum_i u[i] dphi_i/dxi_j(p[qp]) for every \p j < dim.
+   */
+  void gradient (const std::vector<Number> & u,
+                 std::vector<Number> * const du_qp[3]) const;
+
+  /**
+   * Sum-factorized integration, the transpose of \p interpolate():
+   * sets \p r[i] to sum_qp f_qp[qp] phi_i(p[qp]).  Quadrature weights
+   * and Jacobians should already be included in \p f_qp.
+   */
+  void integrate (const std::vector<Number> & f_qp,
+                  std::vector<Number> & r) const;
+
+  /**
+   * The transpose of \p gradient(): sets \p r[i] to
+   * sum_qp sum_j (*g_qp[j])[qp] dphi_i/dxi_j(p[qp]).
+   */
+  void integrate_gradient (std::vector<Number> const * const g_qp[3],
+                           std::vector<Number> & r) const;
+
+  unsigned int dim () const { return _dim; }
+
+  /**
+   * \returns The number of 1D functions per direction.
+   */
+  unsigned int n_1d () const { return _n_1d; }
+
+  /**
+   * \returns The number of distinct coordinates in direction \p d.
+   */
+  unsigned int n_points_1d (unsigned int d) const
+  { return cast_int<unsigned int>(_coords[d].size()); }
+
+private:
+  /**
+   * Contracts direction \p d of the tensor \p in, with extents \p
+   * extents, against a [n_1d x n_points_1d(d)] table.  Maps function
+   * coefficients to points, or points to functions if \p transpose.
+   * Updates \p extents to those of \p result.
+   */
+  void contract (const std::vector<Number> & in,
+                 std::array<unsigned int, 3> & extents,
+                 unsigned int d,
+                 const std::vector<Real> & table,
+                 bool transpose,
+                 std::vector<Number> & result) const;
+
+  unsigned int _dim, _n_1d, _n_qp;
+
+  /**
+   * The distinct coordinates in each direction, sorted.
+   */
+  std::array<std::vector<Real>, 3> _coords;
+
+  /**
+   * The 1D coordinate index of each point in each direction, indexed
+   * by qp*3 + d.
+   */
+  std::vector<unsigned int> _qp_index;
+
+  /**
+   * The point at each grid position, with direction 0 fastest.
+   */
+  std::vector<unsigned int> _grid_to_qp;
+
+  /**
+   * _values[d][flip][a*n_points_1d(d) + x] = f_a(+-coords[d][x]), and
+   * likewise for the derivatives.
+   */
+  std::array<std::array<std::vector<Real>, 2>, 3> _values, _derivs;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_TENSOR_PRODUCT_SHAPES_H
@@ -115,6 +115,20 @@ public:
   {
   }
 
+  /**
+   * Constructor.  Takes a std::vector of objects which will only be
+   * read, such as the element vectors cached by \p MeshBase.
+   *
+   * \note As above, the std::vector MUST live for the lifetime of
+   * this StoredRange, and \p reset() must not be called on a range
+   * built this way.
+   */
+  StoredRange (const vec_type * objs,
+               const unsigned int new_grainsize = 1000) :
+    StoredRange(const_cast<vec_type *>(objs), new_grainsize)
+  {
+  }
+
   /**
    * Copy constructor.  The \p StoredRange can be copied into
    * subranges for parallel execution.  In this way the
@@ -140,8 +154,6 @@ public:
   }
 
   /**
-   * NOTE: When using pthreads this constructor is MANDATORY!!!
-   *
    * Copy constructor.  The \p StoredRange can be copied into
    * subranges for parallel execution.  In this way the
    * initial \p StoredRange can be thought of as the root of
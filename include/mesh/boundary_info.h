@@ -28,6 +28,7 @@
 // C++ includes
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 #include <tuple>
@@ -110,6 +111,53 @@ public:
    */
   void regenerate_id_sets ();
 
+  /**
+   * Moves the side boundary ids out of their multimap into flat,
+   * read-only arrays: the ids of the elements with side boundary ids
+   * in sorted order, per-element offsets, and the (side, id) pairs.
+   * These take much less memory than the multimap, and side id
+   * queries search them directly.
+   *
+   * The multimap is rebuilt, and the arrays discarded, by the next
+   * change to the side boundary ids, by \p get_sideset_map(), or by
+   * \p decompress_side_ids().  Since the arrays are keyed by element
+   * id, meshes decompress them before renumbering elements.
+   */
+  void compress_side_ids ();
+
+  /**
+   * Moves compressed side boundary ids back into their multimap; see
+   * \p compress_side_ids().  Does nothing if they aren't compressed.
+   *
+   * \note This may modify a const BoundaryInfo, so it must not be
+   * called while other threads query this object.
+   */
+  void decompress_side_ids () const;
+
+  /**
+   * Sets whether \p MeshBase::prepare_for_use() calls \p
+   * compress_side_ids() once the mesh is otherwise complete.
+   * Disabled by default, since code that then asks for
+   * \p get_sideset_map() or changes side ids pays for rebuilding the
+   * multimap.
+   */
+  void compress_side_ids_on_prepare (bool compress)
+  { _compress_side_ids_on_prepare = compress; }
+
+  /**
+   * \returns \p true if \p MeshBase::prepare_for_use() compresses
+   * the side boundary ids.
+   */
+  bool compress_side_ids_on_prepare () const
+  { return _compress_side_ids_on_prepare; }
+
+  /**
+   * \returns \p true if the side boundary ids are currently stored
+   * compressed.  See \p compress_side_ids().
+   */
+  bool side_ids_compressed () const
+  { return _compressed_side_ids != nullptr; }
+
 
   /**
    * Generates \p boundary_mesh data structures corresponding to the
@@ -906,10 +954,11 @@ public:
   { return _boundary_edge_id; }
 
   /**
-   * \returns A const reference to the sideset map.
+   * \returns A const reference to the sideset map, first rebuilding
+   * it if the side ids are compressed.
    */
   const std::multimap<const Elem *, std::pair<unsigned short int, boundary_id_type>> & get_sideset_map() const
-  { return _boundary_side_id; }
+  { this->decompress_side_ids(); return _boundary_side_id; }
 
   /**
    * \returns Whether or not there may be child elements directly assigned boundary sides
@@ -933,6 +982,25 @@ private:
    */
   void libmesh_assert_valid_multimaps() const;
 
+  /**
+   * Calls \p f(side, id) for each side boundary id stored on \p elem
+   * itself, from whichever of the multimap or the compressed side ids
+   * currently holds them.
+   */
+  template <typename Action>
+  void for_each_stored_side_id (const Elem * elem, Action && f) const;
+
+  /**
+   * Calls \p f(elem, side, id) for every stored side boundary id.
+   */
+  template <typename Action>
+  void for_each_stored_side_id (Action && f) const;
+
+  /**
+   * \returns The number of stored side boundary ids.
+   */
+  std::size_t n_stored_side_ids () const;
+
   /**
    * Helper method for finding consistent maps of interior to boundary
    * dof_object ids.  Either node_id_map or side_id_map can be nullptr,
@@ -975,12 +1043,35 @@ private:
 
   /**
    * Data structure that maps sides of elements
-   * to boundary ids.
+   * to boundary ids.  Empty while the side ids are compressed, and
+   * rebuilt on demand, hence mutable.
    */
-  std::multimap<const Elem *,
-                std::pair<unsigned short int, boundary_id_type>>
+  mutable std::multimap<const Elem *,
+                        std::pair<unsigned short int, boundary_id_type>>
   _boundary_side_id;
 
+  /**
+   * The side boundary ids, in place of \p _boundary_side_id, once
+   * \p compress_side_ids() has been called: the ids of the elements
+   * with side boundary ids in increasing order, and for each one the
+   * range [offsets[i], offsets[i+1]) of its (side, id) pairs in
+   * \p ids.
+   */
+  struct CompressedSideIds
+  {
+    std::vector<dof_id_type> elem_ids;
+    std::vector<std::size_t> offsets;
+    std::vector<std::pair<unsigned short int, boundary_id_type>> ids;
+  };
+
+  mutable std::unique_ptr<CompressedSideIds> _compressed_side_ids;
+
+  /**
+   * Whether \p MeshBase::prepare_for_use() builds
+   * \p _compressed_side_ids.
+   */
+  bool _compress_side_ids_on_prepare;
+
   /*
    * Whether or not children elements are associated with any boundary
    * It is false by default. The flag will be turned on if `add_side`
@@ -0,0 +1,145 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2025 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_COLORING_H
+#define LIBMESH_ELEM_COLORING_H
+
+// Local Includes
+#include "libmesh/elem_range.h"
+#include "libmesh/enum_coloring_strategy.h"
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class DofMap;
+class Elem;
+class MeshBase;
+
+namespace MeshTools
+{
+
+/**
+ * Partitions the active local elements of a mesh into colors, such
+ * that no two elements of the same color touch the same data.  Each
+ * color can then be handed to \p Threads::parallel_for as its own
+ * range, and the loop body may write to per-node or per-dof data
+ * without locking:
+ *
+ * \code
+ * const auto coloring = mesh.elem_coloring();
+ * for (auto c : make_range(coloring->n_colors()))
+ *   Threads::parallel_for(coloring->range(c), functor);
+ * \endcode
+ *
+ * By default two elements conflict when they share a node.  Given a
+ * \p DofMap, they instead conflict when they share a degree of
+ * freedom, counting the dofs each element's constraints couple it to,
+ * so elements which only meet across a hanging node are still kept
+ * apart.  With \p distance_two, elements also conflict when some
+ * third element shares data with both of them, which is what loops
+ * that write into their neighbors' data (e.g. flux or jump terms)
+ * need.
+ *
+ * \p GREEDY_COLORING gives each element the lowest color it is
+ * allowed, which tends to use the fewest colors but leaves the last
+ * ones nearly empty.  \p BALANCED_COLORING gives each element the
+ * least populated color it is allowed, opening a new color only when
+ * it must, so that every color keeps all threads busy.
+ *
+ * A coloring refers to the elements of the mesh, so it must be
+ * rebuilt whenever they change.  \p MeshBase::elem_coloring() caches
+ * one, and discards it on \p prepare_for_use().
+ *
+ * \brief Conflict-free coloring of the active local elements.
+ */
+class ElemColoring
+{
+public:
+  ElemColoring (const MeshBase & mesh,
+                ColoringStrategy strategy = GREEDY_COLORING,
+                const DofMap * dof_map = nullptr,
+                bool distance_two = false);
+
+  /**
+   * \returns The number of colors used.
+   */
+  unsigned int n_colors () const
+  { return cast_int<unsigned int>(_colors.size()); }
+
+  /**
+   * \returns The elements of color \p c.
+   */
+  const std::vector<const Elem *> & color (unsigned int c) const
+  { libmesh_assert_less(c, _colors.size()); return _colors[c]; }
+
+  /**
+   * \returns A range over the elements of color \p c, for use with
+   * \p Threads::parallel_for.  The range refers to our storage
+   * rather than copying it, so it must not outlive us.
+   */
+  ConstElemRange range (unsigned int c,
+                        unsigned int grainsize = 1000) const;
+
+  /**
+   * \returns The color of \p elem, which must be an active local
+   * element of the mesh we colored.
+   */
+  unsigned int color_of (const Elem & elem) const;
+
+  /**
+   * \returns Whether we were built with these options, and so can be
+   * reused for them.
+   */
+  bool matches (ColoringStrategy strategy,
+                const DofMap * dof_map,
+                bool distance_two) const
+  {
+    return strategy == _strategy && dof_map == _dof_map &&
+      distance_two == _distance_two;
+  }
+
+private:
+  ColoringStrategy _strategy;
+
+  const DofMap * _dof_map;
+
+  bool _distance_two;
+
+  /**
+   * The elements of each color, in mesh iteration order.
+   */
+  std::vector<std::vector<const Elem *>> _colors;
+
+  /**
+   * The id and color of each element we colored, sorted by id.
+   */
+  std::vector<std::pair<dof_id_type, unsigned int>> _elem_colors;
+};
+
+} // namespace MeshTools
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_COLORING_H
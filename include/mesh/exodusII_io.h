@@ -289,6 +289,16 @@ public:
                                  const std::vector<Number> &,
                                  const std::vector<std::string> &) override;
 
+  /**
+   * Write out a nodal solution from a parallel vector.  When writing
+   * in parallel (see set_parallel_writing()), each processor only
+   * localizes the values at its own nodes; otherwise the solution
+   * is gathered onto processor 0.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const NumericVector<Number> &,
+                                 const std::vector<std::string> &) override;
+
   /**
    * Write out a discontinuous nodal solution.
    */
@@ -590,6 +600,21 @@ public:
    */
   void set_hdf5_writing(bool write_hdf5);
 
+  /**
+   * Set to true (false is the default) to write meshes and nodal
+   * solutions without serializing the mesh to processor 0.  Each
+   * processor's nodes and elements are numbered contiguously after
+   * those of lower ranked processors, and processor 0 writes each
+   * processor's range of the file in turn, so no processor ever
+   * holds more than one processor's share of the mesh.
+   *
+   * Writing in parallel requires Exodus 8 or newer, and does not
+   * support added sides, appending, edge boundary conditions,
+   * elemsets, or element, sideset, and nodeset data; when any of
+   * those are needed we quietly fall back to serialized writing.
+   */
+  void set_parallel_writing(bool parallel_writing);
+
   /**
    * Set to true (false is the default) to generate independent nodes
    * for every Bezier Extraction element in an input file containing
@@ -610,6 +635,17 @@ public:
                                bool continuous=true);
 
 private:
+  /**
+   * \returns \p true if the mesh is (or, if no file is open yet,
+   * can be) written in parallel, without serializing it.
+   */
+  bool write_in_parallel();
+
+  /**
+   * Creates \p fname and writes the mesh to it in parallel.
+   */
+  void write_mesh_parallel(const std::string & fname);
+
   /**
    * Only attempt to instantiate an ExodusII helper class
    * if the Exodus API is defined.  This class will have no
@@ -675,6 +711,12 @@ private:
    * for every Bezier Extraction element.
    */
   bool _disc_bex;
+
+  /**
+   * Set to true (false is the default) to write without serializing
+   * the mesh, when possible.
+   */
+  bool _parallel_writing;
 };
 
 
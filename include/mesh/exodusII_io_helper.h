@@ -347,6 +347,73 @@ public:
    */
   virtual void write_nodesets(const MeshBase & mesh);
 
+  /**
+   * \returns \p true if this build of Exodus can write a file in
+   * pieces, as the \p *_parallel() functions below require.
+   */
+  static bool supports_parallel_writing();
+
+  /**
+   * Initializes the Exodus file for writing \p mesh without
+   * serializing it.  Processor p numbers its local nodes, and its
+   * active local elements in each block, contiguously and in id order
+   * after those of processors 0 through p-1.  The offsets are
+   * computed with a parallel exclusive scan, and then processor 0
+   * writes the file one processor's contiguous range at a time, so
+   * it never needs to hold more than one processor's share of the
+   * mesh.
+   *
+   * Added sides, discontinuous output, edge blocks and elemsets are
+   * not supported here.
+   *
+   * Must be called on every processor, as must every other \p
+   * *_parallel() function.
+   */
+  void initialize_parallel(std::string title, const MeshBase & mesh);
+
+  /**
+   * Writes the coordinates and the node number map of every
+   * processor's local nodes.
+   */
+  void write_nodal_coordinates_parallel(const MeshBase & mesh);
+
+  /**
+   * Writes the element blocks, and the connectivity and element
+   * number map of every processor's active local elements.
+   */
+  void write_elements_parallel(const MeshBase & mesh);
+
+  /**
+   * Writes the sidesets of every processor's active local elements.
+   */
+  void write_sidesets_parallel(const MeshBase & mesh);
+
+  /**
+   * Writes the nodesets of every processor's local nodes.
+   */
+  void write_nodesets_parallel(const MeshBase & mesh);
+
+  /**
+   * Writes a nodal variable, given this processor's values at the
+   * nodes of \p parallel_local_node_ids(), in that order.
+   */
+  void write_nodal_values_parallel(int var_id,
+                                   const std::vector<Real> & local_values,
+                                   int timestep);
+
+  /**
+   * \returns \p true if the file open for writing was laid out by
+   * \p initialize_parallel().
+   */
+  bool written_in_parallel() const { return _written_in_parallel; }
+
+  /**
+   * \returns The ids of the nodes this processor writes, in the order
+   * it writes them, after \p initialize_parallel().
+   */
+  const std::vector<dof_id_type> & parallel_local_node_ids() const
+  { return _parallel_local_node_ids; }
+
   /**
    * Sets up the nodal variables
    */
@@ -988,6 +1055,49 @@ protected:
    */
   std::vector<dof_id_type> _true_node_offsets;
 
+  /**
+   * True if the file open for writing was laid out by
+   * initialize_parallel().
+   */
+  bool _written_in_parallel;
+
+  /**
+   * The ids of our local nodes, in the order we number them when
+   * writing in parallel.
+   */
+  std::vector<dof_id_type> _parallel_local_node_ids;
+
+  /**
+   * When writing in parallel, _parallel_node_offsets[p] is the number
+   * of nodes on processors 0 through p-1, so processor p's nodes have
+   * Exodus numbers starting after it.  There are n_processors()+1
+   * entries.
+   */
+  std::vector<dof_id_type> _parallel_node_offsets;
+
+  /**
+   * When writing in parallel, the type of element in each block.
+   */
+  std::vector<ElemType> _parallel_block_types;
+
+  /**
+   * When writing in parallel, _parallel_block_elem_counts[p*num_elem_blk+b]
+   * is the number of elements processor p writes in block b.
+   */
+  std::vector<dof_id_type> _parallel_block_elem_counts;
+
+  /**
+   * When writing in parallel, the number of elements numbered before
+   * our first element in each block.
+   */
+  std::vector<dof_id_type> _parallel_block_elem_offsets;
+
+  /**
+   * \returns The Exodus number of \p node, which must be local or
+   * attached to a local element, when writing in parallel.
+   */
+  dof_id_type parallel_exodus_node_id(const Node & node) const;
+
   /**
    * This class facilitates inline conversion of an input data vector
    * to a different precision level, depending on the underlying type
@@ -46,12 +46,19 @@ class Node;
 class Point;
 class Partitioner;
 class BoundaryInfo;
+class DofMap;
+
+namespace MeshTools
+{
+class ElemColoring;
+}
 
 template <typename T>
 class SparseMatrix;
 
 enum ElemType : int;
 enum ElemMappingType : unsigned char;
+enum ColoringStrategy : int;
 
 template <class MT>
 class MeshInput;
@@ -1500,6 +1507,81 @@ public:
    */
   void clear_point_locator ();
 
+  /**
+   * \returns A coloring of the active local elements with the given
+   * options, building one first if the cached coloring was built with
+   * different options or not at all.  See \p MeshTools::ElemColoring.
+   *
+   * The coloring is returned by shared pointer, so it stays valid for
+   * as long as the caller holds on to it, even if the cache moves on
+   * to a coloring with other options.  It still refers to the mesh's
+   * elements, though, so it must not be used after they change.
+   *
+   * The cached coloring is discarded by \p prepare_for_use() and by
+   * \p DofMap::distribute_dofs(); a coloring over the dofs of
+   * \p dof_map should only be requested once its constraints have
+   * been processed.  Like \p sub_point_locator(), this should not be
+   * called from threaded code unless the coloring has already been
+   * built.
+   */
+  std::shared_ptr<const MeshTools::ElemColoring>
+  elem_coloring (ColoringStrategy strategy,
+                 const DofMap * dof_map = nullptr,
+                 bool distance_two = false) const;
+
+  /**
+   * \returns A \p GREEDY_COLORING of the active local elements by
+   * the nodes they share.
+   */
+  std::shared_ptr<const MeshTools::ElemColoring> elem_coloring () const;
+
+  /**
+   * Releases the cached element coloring, if any.
+   */
+  void clear_elem_coloring ();
+
+  /**
+   * \returns A vector of the active elements, built on demand and
+   * cached, for hot loops in which stepping the predicated
+   * \p active_element_ptr_range() iterators is a noticeable cost.
+   * Wrap it in a \p ConstElemRange to use it with
+   * \p Threads::parallel_for().
+   *
+   * The cached vectors are discarded when elements are added or
+   * deleted, by any \p Partitioner, and by \p prepare_for_use()
+   * and \p clear().  After any other change to which elements are
+   * active, local, or in a given subdomain, call
+   * \p clear_cached_elem_ranges() before using them again.  Like
+   * \p sub_point_locator(), these should not be called from threaded
+   * code unless the vector has already been built.
+   */
+  const std::vector<const Elem *> & cached_active_elements () const;
+
+  /**
+   * \returns A cached vector of the local elements.  See
+   * \p cached_active_elements().
+   */
+  const std::vector<const Elem *> & cached_local_elements () const;
+
+  /**
+   * \returns A cached vector of the active local elements.  See
+   * \p cached_active_elements().
+   */
+  const std::vector<const Elem *> & cached_active_local_elements () const;
+
+  /**
+   * \returns A cached vector of the active local elements in
+   * subdomain \p sid.  The vectors for every subdomain are built
+   * together on the first call.  See \p cached_active_elements().
+   */
+  const std::vector<const Elem *> &
+  cached_active_local_subdomain_elements (subdomain_id_type sid) const;
+
+  /**
+   * Releases the cached element vectors, if any.
+   */
+  void clear_cached_elem_ranges ();
+
   /**
    * In the point locator, do we count lower dimensional elements
    * when we refine point locator regions? This is relevant in
@@ -1910,6 +1992,22 @@ protected:
    */
   mutable std::unique_ptr<PointLocatorBase> _point_locator;
 
+  /**
+   * The element coloring returned by \p elem_coloring(), built on
+   * demand, and so mutable for the same reasons as \p _point_locator.
+   * It is shared with callers, so replacing it here never invalidates
+   * a coloring they still hold.
+   */
+  mutable std::shared_ptr<const MeshTools::ElemColoring> _elem_coloring;
+
+  /**
+   * The element vectors returned by the \p cached_*_elements()
+   * methods, built on demand, and so mutable for the same reasons as
+   * \p _point_locator.
+   */
+  struct CachedElemRanges;
+  mutable std::unique_ptr<CachedElemRanges> _cached_elem_ranges;
+
   /**
    * Do we count lower dimensional elements in point locator refinement?
    * This is relevant in tree-based point locators, for example.
@@ -185,13 +185,18 @@ public:
   /**
    * This method determines a globally unique, partition-agnostic
    * index for each object in the input range.
+   *
+   * Objects are ranked along a Hilbert curve through their points
+   * (or element vertex averages), or along a Morton (Z-order) curve
+   * if \p morton_order is true.
    */
   template <typename ForwardIterator>
   void find_global_indices (const Parallel::Communicator & communicator,
                             const libMesh::BoundingBox &,
                             const ForwardIterator &,
                             const ForwardIterator &,
-                            std::vector<dof_id_type> &) const;
+                            std::vector<dof_id_type> &,
+                            const bool morton_order = false) const;
 
   /**
    * Copy ids of ghost elements from their local processors.
@@ -278,6 +278,59 @@ public:
                 std::vector<Tensor> & output,
                 const std::set<subdomain_id_type> * subdomain_ids);
 
+  /**
+   * Computes values at each of the coordinates \p points and for
+   * time \p time, as operator() would, restricting the points to the
+   * MeshFunction subdomain_ids.  On return \p outputs holds one
+   * vector of values per point.
+   *
+   * The points are ordered along a space-filling curve and located
+   * on threads, starting each search from the element which held the
+   * previous point.  Points falling in the same element then share a
+   * single inverse map and shape function evaluation per variable,
+   * which makes this much cheaper than evaluating many points one at
+   * a time.
+   */
+  void evaluate (const std::vector<Point> & points,
+                 const Real time,
+                 std::vector<DenseVector<Number>> & outputs);
+
+  /**
+   * Computes values at each of the coordinates \p points and for
+   * time \p time, restricting the points to the passed
+   * subdomain_ids, which parameter overrides the internal
+   * subdomain_ids.
+   */
+  void evaluate (const std::vector<Point> & points,
+                 const Real time,
+                 std::vector<DenseVector<Number>> & outputs,
+                 const std::set<subdomain_id_type> * subdomain_ids);
+
+  /**
+   * Like evaluate(), but must be called on all processors at once,
+   * each with its own (possibly empty) vector of \p points.  Points
+   * which cannot be evaluated on this processor, e.g. because the
+   * mesh is distributed or \p _vector is PARALLEL, are sent to the
+   * processors whose local elements' bounding boxes contain them,
+   * and the values computed there are returned.  Where several
+   * processors can evaluate a point, the lowest ranked one's values
+   * are used.  The points are restricted to the MeshFunction
+   * subdomain_ids.
+   */
+  void parallel_evaluate (const std::vector<Point> & points,
+                          const Real time,
+                          std::vector<DenseVector<Number>> & outputs);
+
+  /**
+   * The same as above, restricting the points to the passed
+   * subdomain_ids, which parameter overrides the internal
+   * subdomain_ids.
+   */
+  void parallel_evaluate (const std::vector<Point> & points,
+                          const Real time,
+                          std::vector<DenseVector<Number>> & outputs,
+                          const std::set<subdomain_id_type> * subdomain_ids);
+
   /**
    * \returns The current \p PointLocator object, for use elsewhere.
    *
@@ -363,6 +416,27 @@ protected:
    */
   const Elem * check_found_elem(const Elem * element, const Point & p) const;
 
+  /**
+   * Helper function for evaluate() and parallel_evaluate().  Finds an
+   * evaluable element for each of \p points, or nullptr where there
+   * is none, and fills \p order with the point indices grouped by
+   * element, with the points that weren't found last.
+   */
+  void locate_points (const std::vector<Point> & points,
+                      const std::set<subdomain_id_type> * subdomain_ids,
+                      std::vector<std::size_t> & order,
+                      std::vector<const Elem *> & elems) const;
+
+  /**
+   * Helper function for evaluate() and parallel_evaluate().  Computes
+   * \p outputs at each of \p points for which locate_points() found an
+   * element, leaving the others untouched.
+   */
+  void evaluate_located_points (const std::vector<Point> & points,
+                                const std::vector<std::size_t> & order,
+                                const std::vector<const Elem *> & elems,
+                                std::vector<DenseVector<Number>> & outputs) const;
+
   /**
    * Helper function for finding a gradient as evaluated from a
    * specific element
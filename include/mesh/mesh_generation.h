@@ -65,6 +65,15 @@ class QueryElemSubdomainIDBase;
  *
  * Boundary ids are set to be equal to the side indexing on a
  * master hex
+ *
+ * If \p distributed_generation is true and \p mesh is a distributed
+ * mesh on more than one processor, each processor builds only its
+ * own block of the grid and a layer of ghost elements around it,
+ * with ids computed from grid indices, instead of building the
+ * whole mesh and deleting most of it afterwards.  This is only
+ * supported for tensor product element types (EDGE2, EDGE3, QUAD4,
+ * QUAD8, QUAD9, HEX8, HEX20, HEX27 and their shell variants); other
+ * types are built as usual.
  */
 void build_cube (UnstructuredMesh & mesh,
                  const unsigned int nx=0,
@@ -74,7 +83,8 @@ void build_cube (UnstructuredMesh & mesh,
                  const Real ymin=0., const Real ymax=1.,
                  const Real zmin=0., const Real zmax=1.,
                  const ElemType type=INVALID_ELEM,
-                 const bool gauss_lobatto_grid=false);
+                 const bool gauss_lobatto_grid=false,
+                 const bool distributed_generation=false);
 
 /**
  * A specialized \p build_cube() for 0D meshes.  The resulting
@@ -108,7 +118,8 @@ void build_square (UnstructuredMesh & mesh,
                    const Real xmin=0., const Real xmax=1.,
                    const Real ymin=0., const Real ymax=1.,
                    const ElemType type=INVALID_ELEM,
-                   const bool gauss_lobatto_grid=false);
+                   const bool gauss_lobatto_grid=false,
+                   const bool distributed_generation=false);
 
 /**
  * Meshes a spherical or mapped-spherical domain.
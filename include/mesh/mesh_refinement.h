@@ -35,6 +35,8 @@
 // C++ Includes
 #include <vector>
 
+class MeshRefinementTest;
+
 namespace libMesh
 {
 
@@ -725,6 +727,57 @@ private:
    */
   void update_nodes_map ();
 
+  /**
+   * Where one node of a child of a refined element goes: onto an
+   * existing node of the parent, or onto a new node identified in
+   * \p _new_nodes_map by its bracketing parent nodes.
+   */
+  struct StagedNode;
+
+  /**
+   * The parent node, or else the pairs of bracketing parent nodes,
+   * of each node of each child, for one element type and embedding
+   * matrix version: a copy of what the Elem caches hold, which
+   * threads can read without taking the locks guarding those caches.
+   */
+  struct ChildNodeTable;
+
+  /**
+   * Works out where node \p node of child \p child of \p parent
+   * goes.  On second-order elements which aren't full-order this
+   * reads the children of \p parent created so far.
+   */
+  static void stage_node (const Elem & parent,
+                          unsigned int child,
+                          unsigned int node,
+                          StagedNode & staged);
+
+  /**
+   * Works out where every node of every child of \p parent goes,
+   * indexed by child and then by node, using the \p table for its
+   * type.  This only reads \p parent and \p table, so it is safe to
+   * call on several elements from different threads.
+   */
+  static void stage_children (const Elem & parent,
+                              const ChildNodeTable & table,
+                              std::vector<StagedNode> & staged);
+
+  /**
+   * \returns The location of node \p node of child \p child of
+   * \p parent, from the embedding matrix.
+   */
+  static Point embedded_point (const Elem & parent,
+                               unsigned int child,
+                               unsigned int node);
+
+  /**
+   * \returns The node staged in \p staged, adding it to the mesh
+   * and to \p _new_nodes_map if no other child has yet.
+   */
+  Node * find_or_add_node (Elem & parent,
+                           const StagedNode & staged,
+                           processor_id_type proc_id);
+
   /**
    * Take user-specified coarsening flags and augment them
    * so that level-one dependency is satisfied.
@@ -764,6 +817,14 @@ private:
    */
   TopologyMap _new_nodes_map;
 
+  /**
+   * The element being refined by \p _refine_elements(), if its
+   * children's nodes have already been staged, and those staged
+   * nodes, indexed by child and then by node.
+   */
+  const Elem * _staged_parent;
+  const std::vector<StagedNode> * _staged_nodes;
+
   /**
    * Reference to the mesh.
    */
@@ -890,6 +951,8 @@ private:
 #ifdef LIBMESH_ENABLE_PERIODIC
   PeriodicBoundaries * _periodic_boundaries;
 #endif
+
+  friend class ::MeshRefinementTest;
 };
 
 
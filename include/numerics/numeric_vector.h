@@ -621,6 +621,26 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const = 0;
 
+  /**
+   * Starts a localize(v_local, send_list), but may return before the
+   * values owned by other processors arrive, so that work needing
+   * only locally owned values, read from this vector, can overlap
+   * the communication.  \p v_local may still be being written, so it
+   * must not be used until localize_end(v_local) is called, and this
+   * vector must not be modified in between.
+   *
+   * The default implementation does the whole localize() here.
+   */
+  virtual void localize_begin (NumericVector<T> & v_local,
+                               const std::vector<numeric_index_type> & send_list) const
+  { this->localize(v_local, send_list); }
+
+  /**
+   * Finishes a localize_begin(v_local, send_list).
+   */
+  virtual void localize_end (NumericVector<T> & v_local) const
+  { libmesh_ignore(v_local); }
+
   /**
    * Fill in the local std::vector "v_local" with the global indices
    * given in "indices".
@@ -308,6 +308,11 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const override;
 
+  virtual void localize_begin (NumericVector<T> & v_local,
+                               const std::vector<numeric_index_type> & send_list) const override;
+
+  virtual void localize_end (NumericVector<T> & v_local) const override;
+
   virtual void localize (std::vector<T> & v_local,
                          const std::vector<numeric_index_type> & indices) const override;
 
@@ -84,6 +84,44 @@ private:
 };
 
 
+/**
+ * Overrides the thread count returned by \p libMesh::n_threads() for
+ * the lifetime of this object, so that benchmarks and tests can
+ * compare thread counts within one run.
+ *
+ * The pthread and OpenMP backends honor any count.  The TBB backend
+ * only switches between serial and threaded loops, and without a
+ * threading model the count stays 1.  Must not be used inside a
+ * threaded loop.
+ */
+class ScopedNThreads
+{
+public:
+  explicit
+  ScopedNThreads (unsigned int n) :
+    _old_n_threads(libMeshPrivateData::_n_threads)
+  {
+    libmesh_assert(!in_threads);
+    libmesh_assert_greater(n, 0);
+#if LIBMESH_USING_THREADS
+    libMeshPrivateData::_n_threads = static_cast<int>(n);
+#endif
+  }
+
+  ScopedNThreads (const ScopedNThreads &) = delete;
+  ScopedNThreads & operator= (const ScopedNThreads &) = delete;
+
+  ~ScopedNThreads ()
+  {
+    libmesh_exceptionless_assert(!in_threads);
+    libMeshPrivateData::_n_threads = _old_n_threads;
+  }
+
+private:
+  const int _old_n_threads;
+};
+
+
 /**
  * Simple compatibility class for std::thread 'concurrent' execution.
  * Not at all concurrent, but provides a compatible interface.
@@ -32,7 +32,11 @@
 #endif
 
 #include <pthread.h>
+#include <sched.h>
 #include <algorithm>
+#include <atomic>
+#include <deque>
+#include <optional>
 #include <vector>
 #include <memory> // std::unique_ptr, std::make_unique
 
@@ -213,52 +217,310 @@ private:
 template <typename Range>
 unsigned int num_pthreads(Range & range)
 {
-  std::size_t min = std::min((std::size_t)libMesh::n_threads(), range.size());
+  std::size_t min = std::min((std::size_t)libMesh::n_threads(), std::size_t(range.size()));
   return min > 0 ? cast_int<unsigned int>(min) : 1;
 }
 
-template <typename Range, typename Body>
-class RangeBody
+//-------------------------------------------------------------------
+/**
+ * Dummy "splitting object" used to distinguish splitting constructors
+ * from copy constructors.
+ */
+class split {};
+
+
+
+/**
+ * Abstract unit of parallel work for the persistent thread pool.
+ * Every participating worker calls \p execute() with its own id in
+ * [0, n_workers); the thread which submitted the job is always
+ * worker 0.
+ */
+class PoolJob
 {
 public:
-  Range * range;
-  Body * body;
+  virtual ~PoolJob () = default;
+
+  /**
+   * Does this worker's share of the job, returning once there is no
+   * work left to do or to steal.
+   */
+  virtual void execute (unsigned int worker) = 0;
+
+  /**
+   * Tells all workers to stop picking up new work as soon as
+   * possible.  Called when any worker has thrown an exception.
+   */
+  virtual void abort () = 0;
 };
 
-template <typename Range, typename Body>
-void * run_body(void * args)
+/**
+ * Runs \p job on \p n_workers threads and returns once every worker
+ * has finished.  The calling thread participates as worker 0, the
+ * others are taken from a pool of persistent threads which is grown
+ * on demand.  An exception thrown by any worker is rethrown here.
+ */
+void run_pool_job (PoolJob & job, unsigned int n_workers);
+
+/**
+ * \returns \p true if the calling thread is running the body of a
+ * \p parallel_for() or \p parallel_reduce().  Loops nested in such a
+ * body are run serially by the calling thread, since the pool is
+ * already busy with the outer loop.
+ */
+bool in_pool_job ();
+
+/**
+ * Marks the calling thread as running a loop body, as reported by
+ * \p in_pool_job(), for the lifetime of this object.
+ */
+class PoolJobScope
 {
-  RangeBody<Range, Body> * range_body = (RangeBody<Range, Body> *)args;
+public:
+  PoolJobScope ();
+  ~PoolJobScope ();
 
-  Body & body = *range_body->body;
-  Range & range = *range_body->range;
+  PoolJobScope (const PoolJobScope &) = delete;
+  PoolJobScope & operator= (const PoolJobScope &) = delete;
 
-  body(range);
+private:
+  const bool _was_in_job;
+};
 
-  return nullptr;
-}
+/**
+ * Makes sure the persistent pool can serve \p n_workers workers
+ * (counting the calling thread) without creating threads later.
+ */
+void start_thread_pool (unsigned int n_workers);
 
 /**
- * Scheduler to manage threads.
+ * Joins and destroys all persistent pool threads.  The pool will be
+ * restarted on demand by the next parallel loop.
  */
-class task_scheduler_init
+void stop_thread_pool ();
+
+/**
+ * Work-stealing driver for a divisible \p Range.
+ *
+ * Each worker owns a deque of subranges.  A worker splits the range
+ * it is about to run (using the Range's splitting constructor, never
+ * below its grain size) and pushes the right halves onto the back of
+ * its own deque, then pops from the back when it is done.  Idle
+ * workers steal from the front of other deques, where the largest
+ * pieces are.
+ *
+ * Splitting is adaptive: the initial range is only split deep enough
+ * to give each worker a few pieces, and every stolen piece may be
+ * split further, so unbalanced loops are only subdivided finely where
+ * the imbalance actually is.
+ */
+template <typename Range>
+class RangeStealingJob : public PoolJob
 {
 public:
-  static const int automatic = -1;
-  explicit task_scheduler_init (int = automatic) {}
-  void initialize (int = automatic) {}
-  void terminate () {}
+  RangeStealingJob (const Range & range, unsigned int n_workers) :
+    _n_workers(n_workers),
+    _queues(std::make_unique<WorkerQueue[]>(n_workers)),
+    _pending(1),
+    _aborted(false)
+  {
+    // Aim for ~4 pieces per worker before any stealing happens
+    unsigned int depth = 0;
+    while ((1u << depth) < 4*n_workers)
+      ++depth;
+
+    _queues[0].tasks.emplace_back(range, depth);
+  }
+
+  virtual void execute (unsigned int worker) override
+  {
+    while (!_aborted.load(std::memory_order_relaxed))
+      {
+        std::optional<Task> task = this->next_task(worker);
+
+        if (task)
+          {
+            this->process(worker, *task);
+
+            // Only now are the pieces split off of this task (if
+            // any) the only outstanding work left from it.
+            _pending.fetch_sub(1, std::memory_order_acq_rel);
+          }
+        else if (_pending.load(std::memory_order_acquire) == 0)
+          return;
+        else
+          sched_yield();
+      }
+  }
+
+  virtual void abort () override
+  {
+    _aborted.store(true, std::memory_order_relaxed);
+  }
+
+protected:
+  /**
+   * Runs the user's body, on behalf of worker \p worker, over the
+   * subrange \p r.
+   */
+  virtual void run_body (unsigned int worker, const Range & r) = 0;
+
+private:
+  /**
+   * How many additional times a stolen piece may be split.
+   */
+  static const unsigned int stolen_split_depth = 2;
+
+  struct Task
+  {
+    Task (const Range & r, unsigned int d) : range(r), depth(d) {}
+    Task (Range & r, Threads::split s, unsigned int d) : range(r, s), depth(d) {}
+
+    Range range;
+    unsigned int depth;
+  };
+
+  struct WorkerQueue
+  {
+    spin_mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  /**
+   * \returns The most recently split piece of our own work if there
+   * is one, otherwise a piece stolen from some other worker, otherwise
+   * nothing.
+   */
+  std::optional<Task> next_task (unsigned int worker)
+  {
+    if (std::optional<Task> task = this->pop(worker))
+      return task;
+
+    return this->steal(worker);
+  }
+
+  std::optional<Task> pop (unsigned int worker)
+  {
+    WorkerQueue & queue = _queues[worker];
+    spin_mutex::scoped_lock lock(queue.mutex);
+
+    if (queue.tasks.empty())
+      return std::nullopt;
+
+    std::optional<Task> task(std::in_place, queue.tasks.back());
+    queue.tasks.pop_back();
+    return task;
+  }
+
+  std::optional<Task> steal (unsigned int thief)
+  {
+    for (unsigned int i = 1; i < _n_workers; ++i)
+      {
+        WorkerQueue & victim = _queues[(thief + i) % _n_workers];
+        spin_mutex::scoped_lock lock(victim.mutex);
+
+        if (victim.tasks.empty())
+          continue;
+
+        std::optional<Task> task(std::in_place, victim.tasks.front());
+        victim.tasks.pop_front();
+
+        // Getting stolen means this part of the range is where the
+        // load imbalance is; allow it to be divided more finely.
+        task->depth += stolen_split_depth;
+        return task;
+      }
+
+    return std::nullopt;
+  }
+
+  void process (unsigned int worker, Task & task)
+  {
+    WorkerQueue & queue = _queues[worker];
+
+    while (task.depth && task.range.is_divisible())
+      {
+        --task.depth;
+        _pending.fetch_add(1, std::memory_order_relaxed);
+
+        spin_mutex::scoped_lock lock(queue.mutex);
+        queue.tasks.emplace_back(task.range, Threads::split(), task.depth);
+      }
+
+    this->run_body(worker, task.range);
+  }
+
+  const unsigned int _n_workers;
+  std::unique_ptr<WorkerQueue[]> _queues;
+
+  /**
+   * The number of tasks which are either queued or being run.
+   */
+  std::atomic<std::size_t> _pending;
+
+  std::atomic<bool> _aborted;
 };
 
-//-------------------------------------------------------------------
 /**
- * Dummy "splitting object" used to distinguish splitting constructors
- * from copy constructors.
+ * Pool job for \p parallel_for(): every worker shares the same
+ * (const) body.
  */
-class split {};
+template <typename Range, typename Body>
+class ParallelForJob : public RangeStealingJob<Range>
+{
+public:
+  ParallelForJob (const Range & range, const Body & body, unsigned int n_workers) :
+    RangeStealingJob<Range>(range, n_workers),
+    _body(body)
+  {}
 
+protected:
+  virtual void run_body (unsigned int, const Range & r) override { _body(r); }
 
+private:
+  const Body & _body;
+};
 
+/**
+ * Pool job for \p parallel_reduce(): each worker accumulates into its
+ * own body, which may be invoked on several subranges.
+ */
+template <typename Range, typename Body>
+class ParallelReduceJob : public RangeStealingJob<Range>
+{
+public:
+  ParallelReduceJob (const Range & range, const std::vector<Body *> & bodies) :
+    RangeStealingJob<Range>(range, cast_int<unsigned int>(bodies.size())),
+    _bodies(bodies)
+  {}
+
+protected:
+  virtual void run_body (unsigned int worker, const Range & r) override { (*_bodies[worker])(r); }
+
+private:
+  const std::vector<Body *> & _bodies;
+};
+
+/**
+ * Scheduler to manage threads.  With pthreads this controls the
+ * lifetime of the persistent thread pool used by \p parallel_for()
+ * and \p parallel_reduce().
+ */
+class task_scheduler_init
+{
+public:
+  static const int automatic = -1;
+  explicit task_scheduler_init (int n_workers = automatic) { this->initialize(n_workers); }
+  ~task_scheduler_init () { this->terminate(); }
+
+  void initialize (int n_workers = automatic)
+  {
+    start_thread_pool(n_workers == automatic ? libMesh::n_threads() :
+                      cast_int<unsigned int>(n_workers));
+  }
+
+  void terminate () { stop_thread_pool(); }
+};
 
 //-------------------------------------------------------------------
 /**
@@ -269,75 +531,30 @@ template <typename Range, typename Body>
 inline
 void parallel_for (const Range & range, const Body & body)
 {
-  Threads::BoolAcquire b(Threads::in_threads);
-
-  // If we're running in serial - just run!
-  if (libMesh::n_threads() == 1)
+  // If we're nested in another loop, its workers are all busy
+  if (in_pool_job())
   {
     body(range);
     return;
   }
 
-  DisablePerfLogInScope disable_perf;
+  Threads::BoolAcquire b(Threads::in_threads);
 
   unsigned int n_threads = num_pthreads(range);
 
-  std::vector<std::unique_ptr<Range>> ranges(n_threads);
-  std::vector<RangeBody<const Range, const Body>> range_bodies(n_threads);
-  std::vector<pthread_t> threads(n_threads);
-
-  // Create the ranges for each thread
-  std::size_t range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
-
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      std::size_t this_range_size = range_size;
-
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
-
-      ranges[i] = std::make_unique<Range>(range, current_beginning, current_beginning + this_range_size);
+  // If we're running in serial - just run!
+  if (n_threads == 1)
+  {
+    PoolJobScope job_scope;
+    body(range);
+    return;
+  }
 
-      current_beginning = current_beginning + this_range_size;
-    }
+  DisablePerfLogInScope disable_perf;
 
-  // Create the RangeBody arguments
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      range_bodies[i].range = ranges[i].get();
-      range_bodies[i].body = &body;
-    }
+  ParallelForJob<Range, Body> job(range, body, n_threads);
 
-  // Create the threads.  It may seem redundant to wrap a pragma in
-  // #ifdefs... but GCC warns about an "unknown pragma" if it
-  // encounters this line of code when -fopenmp is not passed to the
-  // compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
-
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    pthread_join(threads[i], nullptr);
-#endif
+  run_pool_job(job, n_threads);
 }
 
 /**
@@ -359,23 +576,29 @@ template <typename Range, typename Body>
 inline
 void parallel_reduce (const Range & range, Body & body)
 {
+  // If we're nested in another loop, its workers are all busy
+  if (in_pool_job())
+  {
+    body(range);
+    return;
+  }
+
   Threads::BoolAcquire b(Threads::in_threads);
 
+  unsigned int n_threads = num_pthreads(range);
+
   // If we're running in serial - just run!
-  if (libMesh::n_threads() == 1)
+  if (n_threads == 1)
   {
+    PoolJobScope job_scope;
     body(range);
     return;
   }
 
   DisablePerfLogInScope disable_perf;
 
-  unsigned int n_threads = num_pthreads(range);
-
-  std::vector<std::unique_ptr<Range>> ranges(n_threads);
   std::vector<std::unique_ptr<Body>> managed_bodies(n_threads); // bodies we are responsible for
   std::vector<Body *> bodies(n_threads); // dumb pointers to managed_bodies
-  std::vector<RangeBody<Range, Body>> range_bodies(n_threads);
 
   // Create n_threads-1 copies of "body". We manage the lifetime of
   // these copies with std::unique_ptrs.
@@ -388,59 +611,9 @@ void parallel_reduce (const Range & range, Body & body)
   for (unsigned int i=1; i<n_threads; i++)
     bodies[i] = managed_bodies[i].get();
 
-  // Create the ranges for each thread
-  std::size_t range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
-
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      std::size_t this_range_size = range_size;
-
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
+  ParallelReduceJob<Range, Body> job(range, bodies);
 
-      ranges[i] = std::make_unique<Range>(range, current_beginning, current_beginning + this_range_size);
-
-      current_beginning = current_beginning + this_range_size;
-    }
-
-  // Create the RangeBody arguments
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      range_bodies[i].range = ranges[i].get();
-      range_bodies[i].body = bodies[i];
-    }
-
-  // Create the threads
-  std::vector<pthread_t> threads(n_threads);
-
-  // It may seem redundant to wrap a pragma in #ifdefs... but GCC
-  // warns about an "unknown pragma" if it encounters this line of
-  // code when -fopenmp is not passed to the compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
-
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-  for (unsigned int i=0; i<n_threads; i++)
-    pthread_join(threads[i], nullptr);
-#endif
+  run_pool_job(job, n_threads);
 
   // Join them all down to the original Body
   for (unsigned int i=n_threads-1; i != 0; i--)
@@ -0,0 +1,126 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2025 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_COST_RECORDER_H
+#define LIBMESH_ELEM_COST_RECORDER_H
+
+// Local Includes
+#include "libmesh/id_types.h"
+
+// C++ Includes
+#include <chrono>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class Elem;
+class MeshBase;
+
+/**
+ * The \p ElemCostRecorder stores measured per-element costs, e.g.
+ * assembly wall times or flop estimates, in the
+ * Partitioner::cost_integer_name element integer of a mesh.  The
+ * next partition() or repartition() of that mesh then balances those
+ * costs instead of the partitioner's default element weights.
+ *
+ * Costs may be in any units, as long as they are consistent across
+ * the mesh.  Only costs recorded on an element's owning processor
+ * are used.  Refined elements inherit the cost of their parent.
+ * Recording costs for distinct elements from different threads is
+ * safe.
+ *
+ * \brief Records measured element costs for load-aware partitioning.
+ */
+class ElemCostRecorder
+{
+public:
+
+  /**
+   * Constructor.  Adds the cost integer to \p mesh, if it doesn't
+   * already have it, so this must be called on all processors at
+   * once.
+   */
+  explicit ElemCostRecorder (MeshBase & mesh);
+
+  /**
+   * Sets the cost of \p elem to \p cost.
+   */
+  void record (Elem & elem, dof_id_type cost) const;
+
+  /**
+   * Adds \p cost to the cost of \p elem, e.g. to combine the costs
+   * of several systems assembled on the same mesh.
+   */
+  void add (Elem & elem, dof_id_type cost) const;
+
+  /**
+   * \returns The cost recorded for \p elem, or
+   * DofObject::invalid_id if none has been.
+   */
+  dof_id_type cost (const Elem & elem) const;
+
+  /**
+   * Forgets the costs recorded for all local elements.
+   */
+  void clear ();
+
+  /**
+   * Records the wall time, in nanoseconds, between its construction
+   * and its destruction as the cost of an element:
+   *
+   * \code
+   * {
+   *   ElemCostRecorder::Timer timer(recorder, elem);
+   *   // ... work on elem ...
+   * }
+   * \endcode
+   */
+  class Timer
+  {
+  public:
+    Timer (const ElemCostRecorder & recorder, Elem & elem) :
+      _recorder(recorder),
+      _elem(elem),
+      _start(std::chrono::steady_clock::now())
+    {}
+
+    ~Timer ()
+    {
+      const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>
+        (std::chrono::steady_clock::now() - _start).count();
+      _recorder.record(_elem, static_cast<dof_id_type>(elapsed));
+    }
+
+  private:
+    const ElemCostRecorder & _recorder;
+    Elem & _elem;
+    const std::chrono::steady_clock::time_point _start;
+  };
+
+private:
+
+  MeshBase & _mesh;
+
+  unsigned int _cost_index;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_COST_RECORDER_H
@@ -30,6 +30,7 @@
 #include <memory>
 #include <unordered_map>
 #include <queue>
+#include <string>
 
 namespace libMesh
 {
@@ -55,7 +56,12 @@ public:
   /**
    * Constructor.
    */
-  Partitioner () : _weights(nullptr) {}
+  Partitioner () :
+    _weights(nullptr),
+    _cost_index(libMesh::invalid_uint),
+    _cost_scale(0),
+    _unmeasured_cost(0)
+  {}
 
   /**
    * Copy/move ctor, copy/move assignment operator, and destructor are
@@ -212,6 +218,15 @@ public:
    */
   virtual void attach_weights(ErrorVector * /*weights*/) { libmesh_not_implemented(); }
 
+  /**
+   * The name of the element integer in which ElemCostRecorder stores
+   * measured element costs.  If a mesh has this integer, partition()
+   * and repartition() balance the recorded costs instead of each
+   * partitioner's default element weights.  Weights attached with
+   * attach_weights() still take precedence.
+   */
+  static const std::string cost_integer_name;
+
 protected:
 
   /**
@@ -275,11 +290,58 @@ protected:
    */
   void assign_partitioning (MeshBase & mesh, const std::vector<dof_id_type> & parts);
 
+  /**
+   * Prepares elem_weight() for partitioning \p mesh: if any element
+   * costs were recorded in it, copies them to ghost and replicated
+   * elements and finds the scaling which turns them into weights.
+   * This is called by partition() and repartition(), on all
+   * processors at once.
+   */
+  void prepare_elem_weights (MeshBase & mesh);
+
+  /**
+   * \returns The weight which should be balanced for \p elem.  If
+   * prepare_elem_weights() found recorded costs, this is the cost of
+   * \p elem, or the mean cost if none was recorded for it, scaled so
+   * that the costliest element weighs up to max_elem_weight.
+   * Otherwise this is an estimate based on the number of nodes of
+   * \p elem.
+   */
+  dof_id_type elem_weight (const Elem & elem) const;
+
+  /**
+   * \returns \p true if elem_weight() is based on recorded costs.
+   */
+  bool have_elem_costs () const { return _cost_index != libMesh::invalid_uint; }
+
+  /**
+   * Passes the element weights found by prepare_elem_weights() on to
+   * \p other, a partitioner which partitions (part of) the mesh on
+   * our behalf.
+   */
+  void share_elem_weights (Partitioner & other) const;
+
+  /**
+   * The largest weight elem_weight() returns for recorded costs.
+   * This is reduced on meshes large enough that the total weight
+   * could otherwise overflow 32-bit partitioner indices.
+   */
+  static const dof_id_type max_elem_weight;
+
   /**
    * The weights that might be used for partitioning.
    */
   ErrorVector * _weights;
 
+  /**
+   * The index of the recorded element costs, the factor turning them
+   * into weights, and the (unscaled) cost assumed for elements with
+   * none recorded, as found by prepare_elem_weights().
+   */
+  unsigned int _cost_index;
+  double _cost_scale;
+  dof_id_type _unmeasured_cost;
+
   /**
    * Maps active element ids into a contiguous range, as needed by parallel partitioner.
    */
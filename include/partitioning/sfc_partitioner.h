@@ -26,6 +26,7 @@
 // C++ Includes
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace libMesh
 {
@@ -34,6 +35,11 @@ namespace libMesh
  * The \p SFCPartitioner uses a Hilbert or Morton-ordered space
  * filling curve to partition the elements.
  *
+ * Serial meshes are ordered by the sfcurves library when it is
+ * available.  Distributed meshes are ordered by a parallel sort of
+ * per-element curve keys, without any processor needing the whole
+ * mesh.
+ *
  * \author Benjamin S. Kirk
  * \date 2003
  * \brief Partitioner based on different types of space filling curves.
@@ -101,6 +107,28 @@ protected:
 
 private:
 
+  /**
+   * Partitions the range by a parallel sort of the elements' Hilbert
+   * or Morton keys, which works on distributed meshes.  This must be
+   * called on all processors at once.
+   */
+  void partition_range_by_keys (MeshBase & mesh,
+                                MeshBase::element_iterator it,
+                                MeshBase::element_iterator end,
+                                const unsigned int n);
+
+  /**
+   * Assigns the range elements, whose ranks along the curve are
+   * \p global_indices, to \p n pieces of nearly equal total
+   * elem_weight().  This must be called on all processors at once.
+   */
+  void assign_weighted_pieces (MeshBase & mesh,
+                               MeshBase::element_iterator beg,
+                               MeshBase::element_iterator end,
+                               const unsigned int n,
+                               const std::vector<dof_id_type> & global_indices,
+                               const dof_id_type n_range_elem);
+
   /**
    * The type of space-filling curve to use.  Hilbert by default.
    */
@@ -515,6 +515,21 @@ public:
   bool get_preevaluate_thetas_flag() const;
   void set_preevaluate_thetas_flag(bool flag);
 
+  /**
+   * Get/set flag to compute the training set error bounds in
+   * \p compute_max_error_bound() on all threads, in batches, using
+   * \p RBEvaluation::compute_residual_dual_norms().  This only takes
+   * effect when the theta functions are pre-evaluated, and gives the
+   * same error bounds as the default path only if the RBEvaluation
+   * does not override \p rb_solve(), \p compute_residual_dual_norm()
+   * or \p get_error_bound_normalization(), and this object does not
+   * override \p get_RB_error_bound().  \p get_stability_lower_bound()
+   * and \p residual_scaling_denom() are still called serially at
+   * each training parameter.
+   */
+  bool get_threaded_error_bounds_flag() const;
+  void set_threaded_error_bounds_flag(bool flag);
+
 
   //----------- PUBLIC DATA MEMBERS -----------//
 
@@ -793,6 +808,14 @@ protected:
    */
   virtual Real get_RB_error_bound();
 
+  /**
+   * Fills \p training_error_bounds with the error bound at each local
+   * training parameter, as \p get_RB_error_bound() would, with the RB
+   * solves and residual norms batched and spread over all threads.
+   * Requires pre-evaluated thetas.
+   */
+  void compute_threaded_error_bounds();
+
   /**
    * Compute the reduced basis matrices for the current basis.
    */
@@ -996,6 +1019,11 @@ private:
    */
   bool _preevaluate_thetas_completed;
 
+  /**
+   * Flag to indicate if we compute training error bounds on threads
+   */
+  bool _threaded_error_bounds_flag;
+
   /**
    * The current training parameter index during reduced basis training.
    */
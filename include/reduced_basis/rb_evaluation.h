@@ -143,6 +143,119 @@ public:
   virtual Real compute_residual_dual_norm(const unsigned int N,
                                           const std::vector<Number> * evaluated_thetas);
 
+  /**
+   * Scratch storage for \p rb_solve_batch() and
+   * \p compute_residual_dual_norms(), kept between calls so that
+   * repeated batched evaluations do not reallocate.  Threads
+   * evaluating at the same time each need their own.
+   */
+  struct BatchWorkspace
+  {
+    /**
+     * The RB system matrices and right hand sides of every sample,
+     * stored contiguously, one after another.
+     */
+    std::vector<Number> system_matrices;
+    std::vector<Number> system_rhss;
+
+    /**
+     * Reused buffers for factoring and solving one RB system.
+     */
+    DenseMatrix<Number> system_matrix;
+    DenseVector<Number> rhs;
+    DenseVector<Number> solution;
+
+    /**
+     * The RB solutions of every sample, stored contiguously.
+     */
+    std::vector<Number> solutions;
+
+    /**
+     * theta_q * u_i for each A term q, basis function i and sample,
+     * with the sample index varying fastest.
+     */
+    std::vector<Number> scaled_solutions;
+
+    /**
+     * One row of a representor inner product block times
+     * \p scaled_solutions, for each sample.
+     */
+    std::vector<Number> row_products;
+
+    /**
+     * The squared residual norms being accumulated.
+     */
+    std::vector<Number> norms_sq;
+
+    /**
+     * Thetas evaluated by the \p RBParameters version of
+     * \p rb_solve_batch().
+     */
+    std::vector<std::vector<Number>> evaluated_thetas;
+    std::vector<const std::vector<Number> *> evaluated_theta_ptrs;
+  };
+
+  /**
+   * Online solves with \p N basis functions at many parameters in one
+   * call, for many-query use.  \p evaluated_thetas holds the
+   * pre-evaluated thetas of each parameter, ordered as for
+   * \p rb_solve().  On return \p outputs holds the RB outputs of each
+   * parameter in turn, get_n_outputs() values apiece, and
+   * \p residual_norms, if provided, the dual norm of each RB residual.
+   * The absolute error bound at a parameter is its residual norm
+   * divided by \p residual_scaling_denom() of its stability lower
+   * bound; those may depend on subclass state, so they are left to
+   * the caller.
+   *
+   * The RB systems of the whole batch are assembled together, then
+   * factored and solved one at a time in buffers from \p workspace,
+   * so that once the workspace has grown to the batch size, repeated
+   * calls do not allocate.  This does not modify the RBEvaluation, so
+   * several threads may call it at once, each with its own
+   * \p workspace.
+   */
+  void rb_solve_batch (unsigned int N,
+                       const std::vector<const std::vector<Number> *> & evaluated_thetas,
+                       BatchWorkspace & workspace,
+                       std::vector<Number> & outputs,
+                       std::vector<Real> * residual_norms = nullptr) const;
+
+  /**
+   * The same as above, except that the thetas are first evaluated
+   * at each of \p mus, which must each hold a single sample, using
+   * the batched evaluation methods of the RBThetaExpansion.  This is
+   * only thread safe if those are.
+   *
+   * \note The thetas are stored in \p workspace, but those batched
+   * evaluation methods return a new vector for each term, so unlike
+   * the overload above this allocates on every call.  Pre-evaluate
+   * the thetas for repeated solves at the same parameters.
+   */
+  void rb_solve_batch (unsigned int N,
+                       const std::vector<RBParameters> & mus,
+                       BatchWorkspace & workspace,
+                       std::vector<Number> & outputs,
+                       std::vector<Real> * residual_norms = nullptr) const;
+
+  /**
+   * Solves the RB system with \p N basis functions for each set of
+   * pre-evaluated thetas in \p evaluated_thetas, then fills
+   * \p residual_norms with the dual norm of each residual, as
+   * \p compute_residual_dual_norm() would, and
+   * \p zero_basis_residual_norms with the dual norm of the residual
+   * for an empty basis.  The residual norms of the whole batch are
+   * evaluated together, as products of each stored representor inner
+   * product block with the matrix of theta-scaled RB solutions.
+   *
+   * Like \p rb_solve_batch(), this may be called from several
+   * threads at once, each with its own \p workspace.
+   */
+  void compute_residual_dual_norms (unsigned int N,
+                                    const std::vector<const std::vector<Number> *> & evaluated_thetas,
+                                    BatchWorkspace & workspace,
+                                    std::vector<Real> & residual_norms,
+                                    std::vector<Real> & zero_basis_residual_norms) const;
+
   /**
    * Specifies the residual scaling on the denominator to
    * be used in the a posteriori error bound. Override
@@ -387,6 +500,25 @@ private:
    * that, when provided, it is the right size.
    */
   void check_evaluated_thetas_size(const std::vector<Number> * evaluated_thetas) const;
+
+  /**
+   * Fills \p workspace.solutions with the RB solution for each set
+   * of thetas in \p evaluated_thetas.
+   */
+  void batch_solve(unsigned int N,
+                   const std::vector<const std::vector<Number> *> & evaluated_thetas,
+                   BatchWorkspace & workspace) const;
+
+  /**
+   * Computes the residual dual norms for the solutions left in
+   * \p workspace by \p batch_solve(), and for an empty basis if
+   * \p zero_basis_residual_norms is not null.
+   */
+  void batch_residual_dual_norms(unsigned int N,
+                                 const std::vector<const std::vector<Number> *> & evaluated_thetas,
+                                 BatchWorkspace & workspace,
+                                 std::vector<Real> & residual_norms,
+                                 std::vector<Real> * zero_basis_residual_norms) const;
 };
 
 }
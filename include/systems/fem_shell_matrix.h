@@ -0,0 +1,231 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2025 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FEM_SHELL_MATRIX_H
+#define LIBMESH_FEM_SHELL_MATRIX_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/shell_matrix.h"
+#include "libmesh/tensor_value.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class FEMSystem;
+class FEMContext;
+template <typename T> class DenseVector;
+template <typename T> class NumericVector;
+
+/**
+ * A matrix-free \p ShellMatrix which applies an FEM operator element
+ * by element, over threaded ranges of the active local elements,
+ * without ever assembling a \p SparseMatrix.
+ *
+ * By default the operator is the Jacobian of an \p FEMSystem at its
+ * current solution.  On each element the system's own residual
+ * kernels compute the element Jacobian, with side terms and
+ * constraints applied exactly as \p FEMSystem::assembly() would.
+ * That Jacobian is applied to the element's part of the input
+ * vector and then discarded, so memory use is one dense element
+ * matrix per thread.
+ *
+ * Alternatively a user \p Kernel can apply the element operator
+ * directly, e.g. with sum factorization via \p TensorProductShapes.
+ * Kernels receive the per-quadrature-point geometric factors of
+ * their element.  With \p cache_geometry() those are computed once
+ * per element and reused.  The element FE objects are then only
+ * reinitialized when the element type or p level changes, so kernels
+ * can rely on reference shape data (e.g. \p get_dphidxi()) but not on
+ * physical data such as \p get_dphi().  In kernel mode, constrained rows of the
+ * operator are the identity and the operator is applied to the
+ * constrained input, i.e. y = C^T A C x on unconstrained rows.
+ *
+ * \brief Matrix-free operator application over an FEMSystem.
+ */
+class FEMShellMatrix : public ShellMatrix<Number>
+{
+public:
+  /**
+   * The geometric factors of one element at its quadrature points.
+   */
+  struct ElemGeometry
+  {
+    /**
+     * Quadrature weights times Jacobian determinants.
+     */
+    std::vector<Real> JxW;
+
+    /**
+     * The inverse map derivatives, dxidx[qp](k,j) = d(xi_k)/d(x_j),
+     * so that a physical gradient is dxidx[qp].transpose() times the
+     * reference gradient.
+     */
+    std::vector<RealTensor> dxidx;
+  };
+
+  /**
+   * Abstract base class for user element operators.
+   */
+  class Kernel
+  {
+  public:
+    /**
+     * Destructor.  Virtual because we will have virtual functions.
+     */
+    virtual ~Kernel () = default;
+
+    /**
+     * Called once on each context, after the system's own
+     * \p init_context(), to request any FE data the kernel needs.
+     */
+    virtual void init_context (FEMContext &) {}
+
+    /**
+     * Adds the action of the element operator on \p x to \p y.
+     * \p context is set up on the element, with its dof indices;
+     * its FE objects have been reinitialized on it unless geometry
+     * is being cached.
+     */
+    virtual void apply (const FEMContext & context,
+                        const ElemGeometry & geometry,
+                        const DenseVector<Number> & x,
+                        DenseVector<Number> & y) const = 0;
+
+    /**
+     * Adds the diagonal of the element operator to \p diag.  The
+     * default implementation applies the operator to each unit
+     * vector in turn, which kernels should override with something
+     * cheaper where they can.
+     */
+    virtual void diagonal (const FEMContext & context,
+                           const ElemGeometry & geometry,
+                           DenseVector<Number> & diag) const;
+  };
+
+  /**
+   * Constructor for applying the Jacobian of \p sys.
+   */
+  explicit
+  FEMShellMatrix (FEMSystem & sys);
+
+  /**
+   * Constructor for applying \p kernel on the elements and dofs of
+   * \p sys.
+   */
+  FEMShellMatrix (FEMSystem & sys,
+                  Kernel & kernel);
+
+  virtual ~FEMShellMatrix ();
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual void vector_mult (NumericVector<Number> & dest,
+                            const NumericVector<Number> & arg) const override;
+
+  virtual void vector_mult_add (NumericVector<Number> & dest,
+                                const NumericVector<Number> & arg) const override;
+
+  virtual void get_diagonal (NumericVector<Number> & dest) const override;
+
+  /**
+   * Drops any cached geometry and work vectors.  Must be called if
+   * the mesh changes.
+   */
+  virtual void clear () override;
+
+  /**
+   * Computes the cached geometry now, if caching is enabled, rather
+   * than on the first application.
+   */
+  virtual void init () override;
+
+  /**
+   * Enables or disables caching the geometric factors of every
+   * element between applications.  Only supported with a \p Kernel,
+   * since the \p FEMSystem kernels need reinitialized FE objects
+   * anyway.
+   */
+  void cache_geometry (bool cache);
+
+private:
+  /**
+   * What an element loop computes.
+   */
+  enum Operation { MULT, DIAGONAL };
+
+  /**
+   * Runs \p op over all the active local elements, adding the
+   * results to \p dest.  \p x is the ghosted input for \p MULT.
+   */
+  void element_loop (Operation op,
+                     NumericVector<Number> & dest,
+                     const NumericVector<Number> * x) const;
+
+  /**
+   * Builds the work vectors for \p vector_mult_add(), unless they
+   * already fit the system's current dof distribution.
+   */
+  void init_work_vectors () const;
+
+  /**
+   * Fills \p geometry from the element FE objects of \p context.
+   */
+  static void compute_geometry (const FEMContext & context,
+                                ElemGeometry & geometry);
+
+  FEMSystem & _sys;
+
+  Kernel * _kernel;
+
+  bool _cache_geometry;
+
+  /**
+   * Cached geometry, and the index into it of each element id.
+   */
+  mutable std::vector<ElemGeometry> _geometry;
+  mutable std::unordered_map<dof_id_type, std::size_t> _geometry_index;
+
+  /**
+   * The input vector with its constraints applied, and the ghosted
+   * input the elements read, kept between applications so that an
+   * iterative solver does not build vectors at every iteration.
+   */
+  mutable std::unique_ptr<NumericVector<Number>> _constrained_x;
+  mutable std::unique_ptr<NumericVector<Number>> _ghosted_x;
+
+  /**
+   * Serializes additions to the output vectors.
+   */
+  mutable Threads::spin_mutex _add_mutex;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_FEM_SHELL_MATRIX_H
@@ -100,6 +100,12 @@ public:
                          bool apply_heterogeneous_constraints = false,
                          bool apply_no_constraints = false) override;
 
+  /**
+   * \returns \p overlap_ghost_updates
+   */
+  virtual bool assembly_updates_solution () const override
+  { return overlap_ghost_updates; }
+
   /**
    * Invokes the solver associated with the system.  For steady state
    * solvers, this will find a root x where F(x) = 0.  For transient
@@ -214,6 +220,53 @@ public:
    */
   Real verify_analytic_jacobians;
 
+  /**
+   * How threads add their element contributions to the global matrix
+   * and residual during \p assembly().  Backends' insertion routines
+   * aren't thread safe, so every insertion is serialized either way.
+   * - \p LOCKED_INSERTION: each element is added as soon as it is
+   *   computed, under a lock shared by all threads.  This is the
+   *   default.
+   * - \p BUFFERED_INSERTION: each thread stages up to
+   *   \p assembly_buffer_size constrained element contributions and
+   *   adds them in one batch, taking the lock once per batch.  With
+   *   many threads and cheap element kernels this avoids most
+   *   contention for the lock.  With one thread the results are
+   *   identical to \p LOCKED_INSERTION.
+   */
+  enum AssemblyInsertion { LOCKED_INSERTION, BUFFERED_INSERTION };
+
+  AssemblyInsertion assembly_insertion;
+
+  /**
+   * The number of elements each thread stages between insertions,
+   * with \p BUFFERED_INSERTION.  Defaults to 64.
+   */
+  unsigned int assembly_buffer_size;
+
+  /**
+   * If this is \p true, \p assembly() records the wall time each
+   * element takes to assemble (excluding its insertion into the
+   * global system) with an \p ElemCostRecorder, so that the next
+   * repartitioning of the mesh balances those costs.  Each assembly
+   * overwrites the costs from the last one.  Defaults to \p false.
+   */
+  bool record_element_costs;
+
+  /**
+   * If this is \p true, \p assembly() updates \p
+   * current_local_solution itself: it starts the update, assembles
+   * on the elements which need only solution values owned by this
+   * processor while the rest are communicated, then finishes the
+   * update and assembles on the remaining elements.  While the update
+   * is in flight, element contexts read their solution values from
+   * \p solution instead of \p current_local_solution.  Solvers then
+   * skip their own update() before assembly.  Element assembly must
+   * only read solution values through its context, and only those
+   * of the current element's dofs.  Defaults to \p false.
+   */
+  bool overlap_ghost_updates;
+
   /**
    * Syntax sugar to make numerical_jacobian() declaration easier.
    */
@@ -247,6 +300,15 @@ public:
    */
   void numerical_nonlocal_jacobian (FEMContext & context) const;
 
+  /**
+   * Computes the Jacobian on the element \p context has been
+   * reinitialized on, including side terms and constraints, exactly
+   * as assembly(false, true) would add it to the system matrix.
+   * This lets e.g. \p FEMShellMatrix apply the Jacobian without
+   * ever assembling it.
+   */
+  void element_jacobian (FEMContext & context);
+
 protected:
   /**
    * Initializes the member data fields associated with
@@ -298,6 +298,21 @@ public:
    */
   virtual void update ();
 
+  /**
+   * Starts an update(), but may return before the values from
+   * neighboring processors arrive.  Work which needs only values
+   * owned by this processor can overlap the communication, reading
+   * them from \p solution.  \p current_local_solution must not be
+   * used until update_end(), and \p solution must not be modified in
+   * between.
+   */
+  void update_begin ();
+
+  /**
+   * Finishes an update_begin().
+   */
+  void update_end ();
+
   /**
    * Prepares \p matrix and \p _dof_map for matrix assembly.
    * Does not actually assemble anything.  For matrix assembly,
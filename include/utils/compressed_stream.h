@@ -0,0 +1,173 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2025 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_COMPRESSED_STREAM_H
+#define LIBMESH_COMPRESSED_STREAM_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstdio> // FILE
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class CompressionCodec;
+
+/**
+ * A \p std::streambuf which compresses everything written to it, or
+ * decompresses everything read from it, in-process, using the bzip2,
+ * xz or zstd libraries.  This replaces writing or reading an
+ * uncompressed temporary file and shelling out to the command-line
+ * tools.
+ *
+ * Output is compressed in large blocks.  Where the codec allows it
+ * those blocks are compressed on multiple threads: xz and zstd use
+ * their own worker threads, and bzip2 blocks are compressed as
+ * independent concatenated streams via \p Threads::parallel_for,
+ * which any bzip2 decoder (including ours) reads back transparently.
+ *
+ * \brief Streaming in-process (de)compression of files.
+ */
+class CompressedStreambuf : public std::streambuf
+{
+public:
+  /**
+   * The supported compression formats.
+   */
+  enum Format { BZIP2, XZ, ZSTD };
+
+  /**
+   * Opens \p filename for reading (if \p mode contains \p
+   * std::ios::in) or writing (if \p mode contains \p std::ios::out),
+   * compressed with \p format.  Check \p is_open() for success.
+   */
+  CompressedStreambuf (const std::string & filename,
+                       Format format,
+                       std::ios_base::openmode mode);
+
+  /**
+   * Finishes the compressed stream, if writing, and closes the file.
+   * Errors are only reported by an explicit \p close().
+   */
+  ~CompressedStreambuf ();
+
+  /**
+   * \returns \p true if the file was opened successfully and has not
+   * been closed.
+   */
+  bool is_open () const { return _file != nullptr; }
+
+  /**
+   * Finishes the compressed stream, if writing, and closes the file.
+   */
+  void close ();
+
+  /**
+   * \returns \p true if this build of libMesh can compress and
+   * decompress \p format in-process.
+   */
+  static bool supported (Format format);
+
+  /**
+   * \returns The format matching the extension of \p filename
+   * (".bz2", ".xz" or ".zst") via \p format, or \p false if the
+   * extension is not one of those.
+   */
+  static bool format_from_name (std::string_view filename, Format & format);
+
+protected:
+  virtual int_type overflow (int_type c) override;
+
+  virtual int sync () override;
+
+  virtual int_type underflow () override;
+
+private:
+  /**
+   * Compresses and writes the contents of the put area, ending the
+   * compressed stream if \p finish is true.
+   */
+  void flush_buffer (bool finish);
+
+  std::unique_ptr<CompressionCodec> _codec;
+
+  std::FILE * _file;
+
+  bool _writing;
+
+  /**
+   * Uncompressed data waiting to be compressed, or already
+   * decompressed and waiting to be read.
+   */
+  std::vector<char> _buffer;
+};
+
+
+
+/**
+ * An input stream reading a file compressed in any of the
+ * \p CompressedStreambuf formats.
+ */
+class CompressedIStream : public std::istream
+{
+public:
+  CompressedIStream (const std::string & filename,
+                     CompressedStreambuf::Format format);
+
+  bool is_open () const { return _buf.is_open(); }
+
+private:
+  CompressedStreambuf _buf;
+};
+
+
+
+/**
+ * An output stream writing a file compressed in any of the
+ * \p CompressedStreambuf formats.  The compressed stream is finished
+ * when this object is destroyed or \p close() is called.
+ */
+class CompressedOStream : public std::ostream
+{
+public:
+  CompressedOStream (const std::string & filename,
+                     CompressedStreambuf::Format format);
+
+  bool is_open () const { return _buf.is_open(); }
+
+  void close () { _buf.close(); }
+
+private:
+  CompressedStreambuf _buf;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_COMPRESSED_STREAM_H
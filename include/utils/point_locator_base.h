@@ -153,6 +153,12 @@ public:
    */
   Real get_close_to_point_tol() const;
 
+  /**
+   * \returns \p true if a user-specified close-to-point tolerance
+   * will be used for an exhaustive search when locating points.
+   */
+  bool get_use_close_to_point_tol() const { return _use_close_to_point_tol; }
+
   /**
    * Set a tolerance to use when determining
    * if a point is contained within the mesh.
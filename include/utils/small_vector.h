@@ -0,0 +1,316 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2025 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SMALL_VECTOR_H
+#define LIBMESH_SMALL_VECTOR_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace libMesh
+{
+
+/**
+ * A contiguous container for trivially copyable types which stores
+ * up to \p N entries inside the object itself, and only allocates
+ * from the heap when it grows beyond that.
+ *
+ * The interface is the subset of \p std::vector used for compact
+ * per-object index storage such as \p DofObject's.  The inline
+ * storage shares its space with the heap pointer, and sizes are
+ * limited to 32 bits so that size and capacity share a word, so a
+ * small object costs little more than an empty \p std::vector would
+ * and needs no separate allocation at all.
+ *
+ * Like \p std::vector, copies allocate exactly as much as they need,
+ * and \p clear() keeps any allocated capacity.
+ *
+ * \brief A std::vector-like container with inline storage.
+ */
+template <typename T, unsigned int N>
+class SmallVector
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "SmallVector only supports trivially copyable types");
+  static_assert(N > 0, "SmallVector needs some inline storage");
+
+public:
+  typedef T                                     value_type;
+  typedef std::size_t                           size_type;
+  typedef std::ptrdiff_t                        difference_type;
+  typedef T &                                   reference;
+  typedef const T &                             const_reference;
+  typedef T *                                   iterator;
+  typedef const T *                             const_iterator;
+
+  SmallVector () :
+    _size(0),
+    _capacity(N)
+  {}
+
+  explicit
+  SmallVector (size_type n, const T & value = T()) :
+    SmallVector()
+  { this->resize(n, value); }
+
+  /**
+   * Copies allocate exactly \p other.size() entries, so copying is
+   * also the way to free unused capacity.
+   */
+  SmallVector (const SmallVector & other) :
+    SmallVector()
+  {
+    this->reserve(other._size);
+    std::memcpy(this->data(), other.data(), other._size * sizeof(T));
+    _size = other._size;
+  }
+
+  SmallVector (SmallVector && other) :
+    SmallVector()
+  { this->steal(other); }
+
+  SmallVector & operator= (const SmallVector & other)
+  {
+    if (this != &other)
+      SmallVector(other).swap(*this);
+    return *this;
+  }
+
+  SmallVector & operator= (SmallVector && other)
+  {
+    if (this != &other)
+      {
+        if (!this->is_inline())
+          delete [] _heap;
+        _capacity = N;
+        this->steal(other);
+      }
+    return *this;
+  }
+
+  ~SmallVector ()
+  {
+    if (!this->is_inline())
+      delete [] _heap;
+  }
+
+  size_type size () const { return _size; }
+
+  bool empty () const { return !_size; }
+
+  size_type capacity () const { return _capacity; }
+
+  T * data () { return this->is_inline() ? _inline : _heap; }
+  const T * data () const { return this->is_inline() ? _inline : _heap; }
+
+  iterator begin () { return this->data(); }
+  iterator end () { return this->data() + _size; }
+  const_iterator begin () const { return this->data(); }
+  const_iterator end () const { return this->data() + _size; }
+
+  T & operator[] (size_type i)
+  { libmesh_assert_less(i, _size); return this->data()[i]; }
+
+  const T & operator[] (size_type i) const
+  { libmesh_assert_less(i, _size); return this->data()[i]; }
+
+  T & back ()
+  { libmesh_assert(_size); return this->data()[_size-1]; }
+
+  const T & back () const
+  { libmesh_assert(_size); return this->data()[_size-1]; }
+
+  /**
+   * Removes all entries, but keeps any allocated capacity.
+   */
+  void clear () { _size = 0; }
+
+  template <typename ForwardIterator>
+  void assign (ForwardIterator first,
+               ForwardIterator last)
+  {
+    this->clear();
+    this->insert(this->end(), first, last);
+  }
+
+  void reserve (size_type n)
+  {
+    if (n > _capacity)
+      this->reallocate(n);
+  }
+
+  /**
+   * Frees unused capacity, moving the entries back inline if they fit.
+   */
+  void shrink_to_fit ()
+  {
+    if (!this->is_inline() && _capacity != _size)
+      this->reallocate(_size);
+  }
+
+  void resize (size_type n, const T & value = T())
+  {
+    if (n > _capacity)
+      this->reallocate(std::max(n, 2*size_type(_capacity)));
+    if (n > _size)
+      std::fill(this->data() + _size, this->data() + n, value);
+    _size = cast_int<std::uint32_t>(n);
+  }
+
+  void push_back (const T & value)
+  {
+    const T copy = value;
+    this->resize(_size + 1, copy);
+  }
+
+  iterator insert (const_iterator pos, const T & value)
+  {
+    // value may refer to one of our own entries
+    const T copy = value;
+    const iterator it = this->open_gap(pos, 1);
+    *it = copy;
+    return it;
+  }
+
+  template <typename ForwardIterator>
+  iterator insert (const_iterator pos,
+                   ForwardIterator first,
+                   ForwardIterator last)
+  {
+    const iterator it = this->open_gap(pos, std::distance(first, last));
+    std::copy(first, last, it);
+    return it;
+  }
+
+  iterator erase (const_iterator first, const_iterator last)
+  {
+    const size_type offset = first - this->begin();
+    const size_type n = last - first;
+    libmesh_assert_less_equal(offset + n, _size);
+
+    T * d = this->data();
+    std::memmove(d + offset, d + offset + n,
+                 (_size - offset - n) * sizeof(T));
+    _size -= cast_int<std::uint32_t>(n);
+    return d + offset;
+  }
+
+  void swap (SmallVector & other)
+  {
+    SmallVector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+private:
+  /**
+   * Heap storage is only ever used for more than \p N entries, so
+   * the capacity tells us which member of the union is active.
+   */
+  bool is_inline () const { return _capacity == N; }
+
+  /**
+   * Takes the entries of \p other, which is left empty.  We must not
+   * own any heap storage.
+   */
+  void steal (SmallVector & other)
+  {
+    libmesh_assert(this->is_inline());
+
+    _size = other._size;
+    if (other.is_inline())
+      std::memcpy(_inline, other._inline, _size * sizeof(T));
+    else
+      {
+        _heap = other._heap;
+        _capacity = other._capacity;
+        other._capacity = N;
+      }
+    other._size = 0;
+  }
+
+  /**
+   * Moves our entries to storage for \p n entries: inline if they
+   * fit, on the heap otherwise.
+   */
+  void reallocate (size_type n)
+  {
+    libmesh_assert_greater_equal(n, _size);
+
+    if (n <= N)
+      {
+        if (!this->is_inline())
+          {
+            T * old = _heap;
+            std::memcpy(_inline, old, _size * sizeof(T));
+            delete [] old;
+            _capacity = N;
+          }
+        return;
+      }
+
+    T * storage = new T[n];
+    std::memcpy(storage, this->data(), _size * sizeof(T));
+    if (!this->is_inline())
+      delete [] _heap;
+    _heap = storage;
+    _capacity = cast_int<std::uint32_t>(n);
+  }
+
+  /**
+   * Makes room for \p n entries at \p pos, returning an iterator to
+   * the first of them.
+   */
+  iterator open_gap (const_iterator pos, size_type n)
+  {
+    const size_type offset = pos - this->begin();
+    libmesh_assert_less_equal(offset, _size);
+
+    const size_type old_size = _size;
+    if (old_size + n > _capacity)
+      this->reallocate(std::max(old_size + n, 2*size_type(_capacity)));
+
+    T * d = this->data();
+    std::memmove(d + offset + n, d + offset,
+                 (old_size - offset) * sizeof(T));
+    _size = cast_int<std::uint32_t>(old_size + n);
+    return d + offset;
+  }
+
+  union
+  {
+    T _inline[N];
+    T * _heap;
+  };
+
+  std::uint32_t _size;
+
+  std::uint32_t _capacity;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SMALL_VECTOR_H
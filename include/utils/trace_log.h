@@ -0,0 +1,253 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2025 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_TRACE_LOG_H
+#define LIBMESH_TRACE_LOG_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+namespace Parallel
+{
+class Communicator;
+}
+
+/**
+ * A low overhead event recorder for timeline profiling.
+ *
+ * \p PerfLog keeps one table of running totals, which it updates
+ * through a map lookup on every push and pop, and which is disabled
+ * inside threaded loops since it isn't thread safe.  \p TraceLog
+ * instead has every thread append begin/end timestamps from
+ * \p std::chrono::steady_clock to its own buffer, with no locking
+ * after a thread's first event.  Each event remembers the enclosing
+ * event on its thread, so events can be summarized by their full
+ * call path, and the raw timeline of every thread on every processor
+ * can be written in the Chrome trace event format, for viewing with
+ * chrome://tracing or Perfetto.
+ *
+ * When enabled, the global \p libMesh::tracelog records every
+ * \p LOG_SCOPE in the library, including those inside
+ * \p Threads::parallel_for.  It is disabled by default; the
+ * \p --trace-log=file.json command line option enables it and writes
+ * the trace when \p LibMeshInit is destroyed.
+ *
+ * Labels and headers are stored as pointers, and so must outlive the
+ * log, as string literals do.
+ *
+ * \brief Per-thread hierarchical event tracing.
+ */
+class TraceLog
+{
+public:
+  typedef std::chrono::steady_clock clock_type;
+
+  /**
+   * Timing statistics of one call path on one processor, summed over
+   * its threads.  Times are in seconds.
+   */
+  struct PathStats
+  {
+    unsigned long long count = 0;
+    double inclusive = 0;
+    double exclusive = 0;
+  };
+
+  /**
+   * Statistics of one call path across the processors of a
+   * communicator.  Processors which never entered the path count as
+   * spending zero time in it.
+   */
+  struct ParallelPathStats
+  {
+    unsigned long long count = 0;
+    double min_inclusive = 0;
+    double max_inclusive = 0;
+    double avg_inclusive = 0;
+    double avg_exclusive = 0;
+  };
+
+  explicit
+  TraceLog (bool enabled = false);
+
+  ~TraceLog ();
+
+  /**
+   * Enables or disables recording.  Recording should only be
+   * disabled while no events are open: any that are stay unfinished,
+   * are not reported, and are discarded by \p clear().
+   */
+  void enable (bool enabled = true)
+  { _enabled.store(enabled, std::memory_order_relaxed); }
+
+  void disable () { this->enable(false); }
+
+  bool enabled () const
+  { return _enabled.load(std::memory_order_relaxed); }
+
+  /**
+   * Opens an event on the calling thread.  Does nothing while
+   * recording is disabled.
+   */
+  void begin (const char * label, const char * header);
+
+  /**
+   * Closes the most recently opened event on the calling thread.
+   * Does nothing while recording is disabled.
+   */
+  void end ();
+
+  /**
+   * Discards all recorded events.  Must not be called while any
+   * thread is recording.
+   */
+  void clear ();
+
+  /**
+   * \returns The number of completed events recorded on this
+   * processor.
+   */
+  std::size_t n_events () const;
+
+  /**
+   * \returns Statistics for each call path recorded on this
+   * processor.  A path is the "header::label" names of an event and
+   * its enclosing events on the same thread, outermost first,
+   * separated by '/'.
+   */
+  std::map<std::string, PathStats> summarize () const;
+
+  /**
+   * \returns The min, max and average over the processors of \p comm
+   * of each call path recorded on any of them.  Only valid on
+   * processor 0.
+   */
+  std::map<std::string, ParallelPathStats>
+  summarize (const Parallel::Communicator & comm) const;
+
+  /**
+   * Prints the statistics from \p summarize(comm) on processor 0.
+   */
+  void print_summary (const Parallel::Communicator & comm,
+                      std::ostream & os) const;
+
+  /**
+   * Writes this processor's events to \p os as a Chrome trace
+   * document, with process id \p pid.
+   */
+  void write_chrome_trace (std::ostream & os,
+                           processor_id_type pid = 0) const;
+
+  /**
+   * Gathers the events of every processor of \p comm and writes them
+   * to \p filename on processor 0, as a Chrome trace document with
+   * one process per MPI rank and one track per thread.
+   */
+  void write_chrome_trace (const std::string & filename,
+                           const Parallel::Communicator & comm) const;
+
+private:
+  /**
+   * One recorded event.  Times are in nanoseconds since the log was
+   * created.
+   */
+  struct Event
+  {
+    const char * label;
+    const char * header;
+    std::int64_t start;
+    std::int64_t stop;
+    std::size_t parent;
+  };
+
+  /**
+   * The events of one thread, and the stack of its open events.
+   */
+  struct ThreadBuffer
+  {
+    std::thread::id thread;
+    unsigned int thread_id;
+    std::vector<Event> events;
+    std::vector<std::size_t> open;
+  };
+
+  /**
+   * \returns The calling thread's buffer, registering a new one on
+   * its first call.
+   */
+  ThreadBuffer & thread_buffer ();
+
+  /**
+   * Appends this processor's events as comma-separated Chrome trace
+   * events to \p os.
+   */
+  void write_events (std::ostream & os,
+                     processor_id_type pid) const;
+
+  std::int64_t now () const
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>
+      (clock_type::now() - _epoch).count();
+  }
+
+  std::atomic<bool> _enabled;
+
+  /**
+   * Distinguishes us from any previous log at the same address in
+   * the thread-local buffer cache.
+   */
+  const unsigned int _instance;
+
+  const clock_type::time_point _epoch;
+
+  /**
+   * Guards \p _buffers while threads register.
+   */
+  mutable std::mutex _buffers_mutex;
+
+  std::vector<std::unique_ptr<ThreadBuffer>> _buffers;
+};
+
+
+
+/**
+ * A \p TraceLog for library-wide tracing, enabled with the
+ * \p --trace-log command line option.
+ */
+extern TraceLog tracelog;
+
+} // namespace libMesh
+
+#endif // LIBMESH_TRACE_LOG_H
@@ -60,6 +60,12 @@ namespace libMesh
  * created to handle equation system output as a replacement for
  * XdrIO since that is somewhat limited.
  *
+ * In READ and WRITE modes, file names ending in ".gz", ".bz2", ".xz"
+ * or ".zst" are (de)compressed on the fly.  The latter three are
+ * streamed through \p CompressedStreambuf when libMesh was built
+ * with the corresponding library; otherwise ".bz2" and ".xz" fall
+ * back on the command-line tools and a temporary file.
+ *
  * \author Benjamin Kirk
  * \date 2003
  * \brief C++ interface for the XDR (eXternal Data Representation) format.
@@ -87,7 +93,8 @@ public:
   Xdr (std::istream & stream);
 
   /**
-   * Destructor.  Closes the file if it is open.
+   * Destructor.  Closes the file if it is open.  Errors on closing
+   * are only reported by an explicit \p close().
    */
   ~Xdr ();
 
@@ -272,7 +279,13 @@ private:
   /**
    * Are we reading/writing zipped files?
    */
-  bool gzipped_file, bzipped_file, xzipped_file;
+  bool gzipped_file, bzipped_file, xzipped_file, zstd_file;
+
+  /**
+   * Are we (de)compressing a .bz2, .xz or .zst file in-process,
+   * rather than via a temporary uncompressed file?
+   */
+  bool streamed_file;
 
   /**
    * Version of the file being read
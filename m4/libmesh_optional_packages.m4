@@ -395,6 +395,15 @@ AS_IF([test "$enablebz2" != no],
                         AC_DEFINE(HAVE_BZIP, 1, [Flag indicating bzip2/bunzip2 are available for handling compressed .bz2 files])
                       ])
               ])
+
+        dnl Prefer compressing in-process with libbz2 when we can.
+        AC_CHECK_HEADER([bzlib.h],
+                        [AC_CHECK_LIB([bz2], [BZ2_bzCompressInit],
+                                      [
+                                        AC_MSG_RESULT(<<< Using libbz2 for streaming compressed .bz2 files >>>)
+                                        AC_DEFINE(HAVE_LIBBZ2, 1, [Flag indicating libbz2 is available for streaming compressed .bz2 files])
+                                        libmesh_optional_LIBS="-lbz2 $libmesh_optional_LIBS"
+                                      ])])
       ])
 # -------------------------------------------------------------
 
@@ -416,6 +425,38 @@ AS_IF([test "$enablexz" != no],
                 AC_MSG_RESULT(<<< Using xz for writing/reading compressed .xz files >>>)
                 AC_DEFINE(HAVE_XZ, 1, [Flag indicating xz is available for handling compressed .xz files])
               ])
+
+        dnl Prefer compressing in-process with liblzma when we can;
+        dnl we need its multithreaded encoder.
+        AC_CHECK_HEADER([lzma.h],
+                        [AC_CHECK_LIB([lzma], [lzma_stream_encoder_mt],
+                                      [
+                                        AC_MSG_RESULT(<<< Using liblzma for streaming compressed .xz files >>>)
+                                        AC_DEFINE(HAVE_LIBLZMA, 1, [Flag indicating liblzma is available for streaming compressed .xz files])
+                                        libmesh_optional_LIBS="-llzma $libmesh_optional_LIBS"
+                                      ])])
+      ])
+# -------------------------------------------------------------
+
+
+# -------------------------------------------------------------
+# Compressed Files with zstd
+# -------------------------------------------------------------
+AC_ARG_ENABLE(zstd,
+              AS_HELP_STRING([--disable-zstd],
+                             [build without zstd compressed I/O support]),
+              enablezstd=$enableval,
+              enablezstd=$enableoptional)
+
+AS_IF([test "$enablezstd" != no],
+      [
+        AC_CHECK_HEADER([zstd.h],
+                        [AC_CHECK_LIB([zstd], [ZSTD_compressStream2],
+                                      [
+                                        AC_MSG_RESULT(<<< Using libzstd for streaming compressed .zst files >>>)
+                                        AC_DEFINE(HAVE_ZSTD, 1, [Flag indicating libzstd is available for streaming compressed .zst files])
+                                        libmesh_optional_LIBS="-lzstd $libmesh_optional_LIBS"
+                                      ])])
       ])
 # -------------------------------------------------------------
 
@@ -10,7 +10,9 @@
 #include <libmesh/face_c0polygon.h>
 #include <libmesh/fe.h>
 #include <libmesh/fe_base.h>
+#include <libmesh/fe_element_block.h>
 #include <libmesh/fe_interface.h>
+#include <libmesh/fe_lagrange_shape_1D.h>
 #include <libmesh/function_base.h>
 #include <libmesh/mesh.h>
 #include <libmesh/mesh_generation.h>
@@ -18,7 +20,10 @@
 #include <libmesh/numeric_vector.h>
 #include <libmesh/system.h>
 #include <libmesh/quadrature_gauss.h>
+#include <libmesh/tensor_product_shapes.h>
 
+#include <cstdint>
+#include <map>
 #include <vector>
 
 #include "libmesh_cppunit.h"
@@ -32,7 +37,10 @@
   CPPUNIT_TEST( testHessU );                    \
   CPPUNIT_TEST( testHessUComp );                \
   CPPUNIT_TEST( testDualDoesntScreamAndDie );   \
-  CPPUNIT_TEST( testCustomReinit );
+  CPPUNIT_TEST( testCustomReinit );             \
+  CPPUNIT_TEST( testFlatShapes );               \
+  CPPUNIT_TEST( testElementBlock );             \
+  CPPUNIT_TEST( testTensorProductShapes );
 
 using namespace libMesh;
 
@@ -1010,6 +1018,247 @@ public:
     }
   }
 
+  void testFlatShapes()
+  {
+    LOG_UNIT_TEST;
+
+    FEType fe_type = this->_sys->variable_type(0);
+    std::unique_ptr<FEBase> fe (FEBase::build(this->_dim, fe_type));
+    fe->attach_quadrature_rule (this->_qrule.get());
+
+    const auto & phi = fe->get_phi();
+    const auto & dphi = fe->get_dphi();
+
+    // Held across reinit() calls, as an init_context() would
+    const auto & flat_phi = fe->get_flat_phi();
+    const auto & flat_dphi = fe->get_flat_dphi();
+
+    for (const auto & elem : this->_mesh->active_local_element_ptr_range())
+      {
+        fe->reinit (elem);
+
+        CPPUNIT_ASSERT_EQUAL(phi.size(), flat_phi.size());
+        CPPUNIT_ASSERT_EQUAL(dphi.size(), flat_dphi.size());
+
+        for (auto i : index_range(phi))
+          {
+            CPPUNIT_ASSERT_EQUAL(phi[i].size(), flat_phi[i].size());
+            CPPUNIT_ASSERT_EQUAL(std::uintptr_t(0),
+                                 reinterpret_cast<std::uintptr_t>(flat_phi.row_data(i)) %
+                                 FlatShapeArray<Real>::alignment);
+
+            for (auto qp : index_range(phi[i]))
+              {
+                CPPUNIT_ASSERT_EQUAL(phi[i][qp], flat_phi[i][qp]);
+                CPPUNIT_ASSERT_EQUAL(phi[i][qp], flat_phi(i,qp));
+                CPPUNIT_ASSERT_EQUAL(dphi[i][qp], flat_dphi[i][qp]);
+              }
+          }
+      }
+
+    // Requested only after a reinit(), a flat array starts out as a
+    // copy of the current values and is then kept current
+    std::unique_ptr<FEBase> late_fe (FEBase::build(this->_dim, fe_type));
+    late_fe->attach_quadrature_rule (this->_qrule.get());
+    const auto & late_phi = late_fe->get_phi();
+
+    const FlatShapeArray<Real> * late_flat_phi = nullptr;
+    for (const auto & elem : this->_mesh->active_local_element_ptr_range())
+      {
+        late_fe->reinit (elem);
+
+        if (!late_flat_phi)
+          late_flat_phi = &late_fe->get_flat_phi();
+
+        CPPUNIT_ASSERT_EQUAL(late_phi.size(), late_flat_phi->size());
+        for (auto i : index_range(late_phi))
+          for (auto qp : index_range(late_phi[i]))
+            CPPUNIT_ASSERT_EQUAL(late_phi[i][qp], (*late_flat_phi)(i,qp));
+      }
+  }
+
+  void testElementBlock()
+  {
+    LOG_UNIT_TEST;
+
+    FEType fe_type = this->_sys->variable_type(0);
+
+    std::unique_ptr<FEBase> block_fe (FEBase::build(this->_dim, fe_type));
+    block_fe->attach_quadrature_rule (this->_qrule.get());
+    FEElementBlock block(*block_fe);
+
+    // A separate FE object to compare against element by element
+    std::unique_ptr<FEBase> fe (FEBase::build(this->_dim, fe_type));
+    fe->attach_quadrature_rule (this->_qrule.get());
+    const auto & JxW = fe->get_JxW();
+    const auto & phi = fe->get_phi();
+    const auto & dphi = fe->get_dphi();
+
+    // Gather blocks of up to 4 same-type elements
+    std::map<ElemType, std::vector<const Elem *>> elems_by_type;
+    for (const auto & elem : this->_mesh->active_local_element_ptr_range())
+      if (elem->p_level() == 0)
+        elems_by_type[elem->type()].push_back(elem);
+
+    for (const auto & [type, elems] : elems_by_type)
+      for (std::size_t start = 0; start < elems.size(); start += 4)
+        {
+          const std::vector<const Elem *> batch
+            (elems.begin() + start,
+             elems.begin() + std::min(start + 4, elems.size()));
+
+          block.reinit(batch);
+          CPPUNIT_ASSERT_EQUAL(batch.size(), std::size_t(block.n_elem()));
+
+          for (auto e : index_range(batch))
+            {
+              fe->reinit(batch[e]);
+
+              CPPUNIT_ASSERT_EQUAL(JxW.size(), std::size_t(block.n_qp()));
+              CPPUNIT_ASSERT_EQUAL(phi.size(), std::size_t(block.n_shape_functions()));
+
+              for (auto qp : index_range(JxW))
+                LIBMESH_ASSERT_FP_EQUAL(JxW[qp], block.JxW(e, qp),
+                                        this->_value_tol * std::abs(JxW[qp]));
+
+              for (auto i : index_range(phi))
+                for (auto qp : index_range(phi[i]))
+                  {
+                    LIBMESH_ASSERT_FP_EQUAL(phi[i][qp], block.phi(e, i, qp),
+                                            this->_value_tol);
+                    const RealGradient grad = block.dphi(e, i, qp);
+                    for (unsigned int d = 0; d != LIBMESH_DIM; ++d)
+                      LIBMESH_ASSERT_FP_EQUAL(dphi[i][qp](d), grad(d),
+                                              this->_grad_tol * (1 + std::abs(dphi[i][qp](d))));
+                  }
+            }
+        }
+  }
+
+  void testTensorProductShapes()
+  {
+    LOG_UNIT_TEST;
+
+    // The sum-factorized paths are only taken for these families, on
+    // tensor-product elements
+    if (family != LAGRANGE && family != HIERARCHIC && family != L2_HIERARCHIC)
+      return;
+
+    if (elem_type != QUAD4 && elem_type != QUAD8 && elem_type != QUAD9 &&
+        elem_type != HEX8 && elem_type != HEX20 && elem_type != HEX27)
+      return;
+
+    FEType fe_type = this->_sys->variable_type(0);
+    std::unique_ptr<FEBase> fe (FEBase::build(this->_dim, fe_type));
+    fe->attach_quadrature_rule (this->_qrule.get());
+
+    const auto & phi = fe->get_phi();
+    const std::vector<std::vector<Real>> * dphidxi[3] =
+      { &fe->get_dphidxi(),
+        (this->_dim > 1) ? &fe->get_dphideta() : nullptr,
+        (this->_dim > 2) ? &fe->get_dphidzeta() : nullptr };
+
+    const std::vector<Point> & qp_points = this->_qrule->get_points();
+
+    // Whatever path all_shapes() took, it should agree with pointwise
+    // evaluation.
+    for (const auto & elem : this->_mesh->active_local_element_ptr_range())
+      {
+        fe->reinit (elem);
+
+        for (auto i : index_range(phi))
+          for (auto qp : index_range(phi[i]))
+            {
+              const Real val = FEInterface::shape(fe_type, elem, i, qp_points[qp]);
+              LIBMESH_ASSERT_FP_EQUAL(val, phi[i][qp],
+                                      this->_value_tol * (1 + std::abs(val)));
+
+              for (unsigned int j = 0; j != this->_dim; ++j)
+                {
+                  const Real deriv =
+                    FEInterface::shape_deriv(fe_type, elem, i, j, qp_points[qp]);
+                  LIBMESH_ASSERT_FP_EQUAL(deriv, (*dphidxi[j])[i][qp],
+                                          this->_grad_tol * (1 + std::abs(deriv)));
+                }
+            }
+      }
+
+    // Check the sum-factorized operator action against the full
+    // shape function tables, on the 1D quadratic Lagrange basis.
+    TensorProductShapes tensor;
+    if (this->_dim < 2 || !tensor.init(this->_dim, qp_points))
+      return;
+
+    tensor.tabulate(3, fe_lagrange_1D_quadratic_shape,
+                    [](unsigned int i, Real xi)
+                    { return fe_lagrange_1D_quadratic_shape_deriv(i, 0, xi); });
+
+    const unsigned int n_dofs = (this->_dim == 2) ? 9 : 27;
+    const std::size_t n_qp = qp_points.size();
+
+    std::vector<std::vector<Real>> table(n_dofs, std::vector<Real>(n_qp));
+    std::vector<std::vector<Real>> dtable[3];
+    for (unsigned int j = 0; j != this->_dim; ++j)
+      dtable[j].resize(n_dofs, std::vector<Real>(n_qp));
+
+    for (unsigned int a = 0; a != 3; ++a)
+      for (unsigned int b = 0; b != 3; ++b)
+        for (unsigned int c = 0; c != ((this->_dim == 3) ? 3u : 1u); ++c)
+          {
+            TensorProductShapes::Factorization f;
+            f.index = {{a, b, c}};
+            const unsigned int i = tensor.lexicographic_index(f.index);
+            tensor.values(f, table[i]);
+            std::vector<Real> * d[3] =
+              { &dtable[0][i], &dtable[1][i],
+                (this->_dim == 3) ? &dtable[2][i] : nullptr };
+            tensor.derivs(f, d);
+          }
+
+    std::vector<Number> u(n_dofs), f_qp(n_qp);
+    for (auto i : make_range(n_dofs))
+      u[i] = 0.25 + i*0.5 - 0.02*i*i;
+    for (auto qp : make_range(n_qp))
+      f_qp[qp] = 1.5 - 0.1*qp;
+
+    std::vector<Number> u_qp, du_qp[3], r, r_grad;
+    std::vector<Number> * du_ptrs[3] = { &du_qp[0], &du_qp[1], &du_qp[2] };
+    tensor.interpolate(u, u_qp);
+    tensor.gradient(u, du_ptrs);
+    tensor.integrate(f_qp, r);
+    const std::vector<Number> * g_ptrs[3] = { &f_qp, &u_qp, &f_qp };
+    tensor.integrate_gradient(g_ptrs, r_grad);
+
+    for (auto qp : make_range(n_qp))
+      {
+        Number val = 0;
+        for (auto i : make_range(n_dofs))
+          val += u[i] * table[i][qp];
+        LIBMESH_ASSERT_NUMBERS_EQUAL(val, u_qp[qp], this->_value_tol);
+
+        for (unsigned int j = 0; j != this->_dim; ++j)
+          {
+            Number grad = 0;
+            for (auto i : make_range(n_dofs))
+              grad += u[i] * dtable[j][i][qp];
+            LIBMESH_ASSERT_NUMBERS_EQUAL(grad, du_qp[j][qp], this->_grad_tol);
+          }
+      }
+
+    for (auto i : make_range(n_dofs))
+      {
+        Number val = 0, grad = 0;
+        for (auto qp : make_range(n_qp))
+          {
+            val += f_qp[qp] * table[i][qp];
+            for (unsigned int j = 0; j != this->_dim; ++j)
+              grad += (*g_ptrs[j])[qp] * dtable[j][i][qp];
+          }
+        LIBMESH_ASSERT_NUMBERS_EQUAL(val, r[i], this->_value_tol);
+        LIBMESH_ASSERT_NUMBERS_EQUAL(grad, r_grad[i], this->_grad_tol);
+      }
+  }
+
 };
 
 